@@ -0,0 +1,51 @@
+#include <iostream>
+#include <string>
+#include "benchmarks.h"
+#include "set.h"
+
+namespace {
+    std::string numbered_set(size_t first, size_t last) {
+        std::string text = "{";
+        for (size_t number = first; number < last; ++number) text += benchmark_element(number);
+        return text + "}";
+    }
+}
+
+void run_algebra_benchmark() {
+    const size_t element_number = 10000;
+    const size_t repeat_number = 20;
+    cantor_set first_set('{');
+    cantor_set second_set('{');
+    double parse_seconds = measure_seconds([&] {
+        first_set = cantor_set(numbered_set(0, element_number));
+        second_set = cantor_set(numbered_set(element_number / 2, element_number + element_number / 2));
+    });
+    cantor_set first_copy(numbered_set(0, element_number));
+
+    size_t result_size = 0;
+    double union_seconds = measure_seconds([&] {
+        for (size_t i = 0; i < repeat_number; ++i) result_size += (first_set + second_set).set_length();
+    });
+    double intersection_seconds = measure_seconds([&] {
+        for (size_t i = 0; i < repeat_number; ++i) result_size += (first_set * second_set).set_length();
+    });
+    double difference_seconds = measure_seconds([&] {
+        for (size_t i = 0; i < repeat_number; ++i) result_size += (first_set - second_set).set_length();
+    });
+    size_t equal = 0;
+    double equality_seconds = measure_seconds([&] {
+        for (size_t i = 0; i < repeat_number; ++i) equal += first_set == first_copy;
+    });
+    size_t found = 0;
+    double lookup_seconds = measure_seconds([&] {
+        for (size_t number = 0; number < element_number; ++number) found += first_set[benchmark_element(number * 2)];
+    });
+
+    std::cout << "[algebra] два множества по " << element_number << " вложенных элементов, половина общих\n"
+              << "  разбор обоих " << parse_seconds * 1000 << " мс\n"
+              << "  объединение " << union_seconds * 1000 / repeat_number << " мс, пересечение "
+              << intersection_seconds * 1000 / repeat_number << " мс, разность "
+              << difference_seconds * 1000 / repeat_number << " мс (элементов " << result_size << ")\n"
+              << "  сравнение " << equality_seconds * 1e9 / repeat_number << " нс (равных " << equal
+              << "), поиск " << lookup_seconds * 1e6 / element_number << " мкс (найдено " << found << ")\n";
+}
@@ -0,0 +1,68 @@
+/**
+ * @file allocation_counter.cpp
+ * @brief Замена глобальных operator new и operator delete, считающая выделения памяти
+ * @details Операторы определены в отдельной единице трансляции, где нет выражений new и delete,
+ * чтобы компилятор не встраивал их тела в чужой код. Выровненные варианты, которые
+ * использует std::pmr::new_delete_resource, тоже заменены и считаются отдельно.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include "benchmarks.h"
+
+namespace {
+    std::atomic<size_t> plain_allocations{0}; ///< Вызовы operator new без выравнивания
+    std::atomic<size_t> aligned_allocations{0}; ///< Вызовы operator new с std::align_val_t
+
+    void* allocate_plain(size_t size) {
+        plain_allocations.fetch_add(1, std::memory_order_relaxed);
+        if (void* memory = std::malloc(size ? size : 1)) return memory;
+        throw std::bad_alloc();
+    }
+
+    // Перед выровненным блоком хранится адрес, полученный от malloc
+    void* allocate_aligned(size_t size, std::align_val_t alignment) {
+        aligned_allocations.fetch_add(1, std::memory_order_relaxed);
+        size_t align = static_cast<size_t>(alignment);
+        void* memory = std::malloc(size + align + sizeof(void*));
+        if (!memory) throw std::bad_alloc();
+        std::uintptr_t start = reinterpret_cast<std::uintptr_t>(memory) + sizeof(void*);
+        std::uintptr_t aligned = (start + align - 1) & ~static_cast<std::uintptr_t>(align - 1);
+        reinterpret_cast<void**>(aligned)[-1] = memory;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void free_aligned(void* memory) noexcept {
+        if (memory) std::free(static_cast<void**>(memory)[-1]);
+    }
+}
+
+allocation_counts current_allocation_counts() {
+    return {plain_allocations.load(std::memory_order_relaxed), aligned_allocations.load(std::memory_order_relaxed)};
+}
+
+void* operator new(size_t size) {
+    return allocate_plain(size);
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    return allocate_aligned(size, alignment);
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+    free_aligned(memory);
+}
+
+void operator delete(void* memory, size_t, std::align_val_t) noexcept {
+    free_aligned(memory);
+}
@@ -0,0 +1,49 @@
+#include <iostream>
+#include <string>
+#include "benchmarks.h"
+#include "set.h"
+#include "set_manager.h"
+
+namespace {
+    struct allocation_result {
+        size_t allocations; ///< Все вызовы operator new
+        size_t aligned_allocations; ///< Из них выровненные
+        double seconds;
+    };
+
+    template<typename function>
+    allocation_result count_allocations(function function_) {
+        allocation_counts before = current_allocation_counts();
+        double seconds = measure_seconds(function_);
+        allocation_counts after = current_allocation_counts();
+        size_t aligned = after.aligned - before.aligned;
+        return {after.plain - before.plain + aligned, aligned, seconds};
+    }
+
+    void run_case(const char* name, const std::string& text) {
+        size_t nodes_before = set_pool::instance().node_count();
+        cantor_set* parsed = nullptr;
+        allocation_result parse = count_allocations([&] { parsed = new cantor_set(cantor_set::parse(text)); });
+        size_t node_number = set_pool::instance().node_count() - nodes_before;
+        allocation_result destroy = count_allocations([&] { delete parsed; });
+        std::cout << "  " << name << ": узлов " << node_number << ", разбор " << parse.allocations << " выделений ("
+                  << "выровненных " << parse.aligned_allocations << ", "
+                  << static_cast<double>(parse.allocations) / node_number << " на узел, " << parse.seconds * 1000
+                  << " мс), удаление " << destroy.allocations << " выделений (" << destroy.seconds * 1000 << " мс)\n";
+    }
+}
+
+void run_arena_benchmark() {
+    std::cout << "[arena] количество выделений памяти при разборе и удалении\n";
+    std::string nested = "{";
+    for (size_t number = 0; number < 20000; ++number) nested += benchmark_element(number) + ",";
+    nested.back() = '}';
+    run_case("20000 элементов глубины 4", nested);
+    std::string directed = "{";
+    for (size_t number = 0; number < 20000; ++number)
+        directed += "<" + benchmark_element(number) + "," + benchmark_element(number + 1) + ">,";
+    directed.back() = '}';
+    run_case("20000 пар <>", directed);
+    const size_t depth = 100000;
+    run_case("цепочка глубины 100000", std::string(depth, '{') + "a" + std::string(depth, '}'));
+}
@@ -0,0 +1,39 @@
+/**
+ * @file benchmark_main.cpp
+ * @brief Точка входа для замеров производительности
+ * @details Без аргументов запускает все замеры, иначе только перечисленные по имени.
+ */
+
+#include <iostream>
+#include <string>
+#include <map>
+#include <functional>
+#include "benchmarks.h"
+
+int main(int argc, char* argv[]) {
+    const std::map<std::string, std::function<void()>> benchmarks = {
+            {"intern", run_intern_benchmark},
+            {"algebra", run_algebra_benchmark},
+            {"index", run_index_benchmark},
+            {"manager", run_manager_benchmark},
+            {"boolean", run_boolean_benchmark},
+            {"parallel", run_parallel_benchmark},
+            {"parser", run_parser_benchmark},
+            {"depth", run_depth_benchmark},
+            {"arena", run_arena_benchmark},
+            {"serialize", run_serialize_benchmark},
+    };
+    if (argc == 1) {
+        for (const auto& [name, benchmark] : benchmarks) benchmark();
+        return 0;
+    }
+    for (int i = 1; i < argc; ++i) {
+        auto benchmark = benchmarks.find(argv[i]);
+        if (benchmark == benchmarks.end()) {
+            std::cerr << "Неизвестный замер: " << argv[i] << "\n";
+            return 1;
+        }
+        benchmark->second();
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file benchmarks.h
+ * @brief Общие объявления замеров производительности канторовских множеств
+ * @author Ященко Александра
+ */
+
+#ifndef SEM3_L1_PPOIS_P2_BENCHMARKS_H
+#define SEM3_L1_PPOIS_P2_BENCHMARKS_H
+
+#include <chrono>
+#include <string>
+
+/**
+ * @brief Измеряет время выполнения функции
+ * @param function_ Функция без параметров
+ * @return Время выполнения в секундах
+ */
+template<typename function>
+double measure_seconds(function function_) {
+    auto start = std::chrono::steady_clock::now();
+    function_();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/**
+ * @brief Формирует уникальный элемент множества по номеру
+ * @param number Номер элемента
+ * @return Вложенное множество вида {a{b{c{d}}}}, где буквы - цифры номера по основанию 26
+ */
+inline std::string benchmark_element(size_t number) {
+    std::string element;
+    for (size_t level = 0; level < 4; ++level) {
+        element += '{';
+        element += static_cast<char>('a' + number % 26);
+        number /= 26;
+    }
+    return element + "}}}}";
+}
+
+/**
+ * @struct allocation_counts
+ * @brief Количество вызовов глобального operator new с начала работы программы
+ */
+struct allocation_counts {
+    size_t plain; ///< Выделения без выравнивания
+    size_t aligned; ///< Выделения с std::align_val_t, в том числе из std::pmr::new_delete_resource
+};
+
+/**
+ * @brief Возвращает счетчики выделений памяти
+ * @return Текущие значения счетчиков из allocation_counter.cpp
+ */
+allocation_counts current_allocation_counts();
+
+/**
+ * @brief Замер памяти и времени операций над глубоко вложенными множествами
+ */
+void run_intern_benchmark();
+
+/**
+ * @brief Замер объединения, пересечения, разности и сравнения множеств из 10000 элементов
+ */
+void run_algebra_benchmark();
+
+/**
+ * @brief Замер разбора, поиска, добавления и удаления в больших множествах
+ */
+void run_index_benchmark();
+
+/**
+ * @brief Замер операций set_manager над множествами букв и смешанными множествами
+ */
+void run_manager_benchmark();
+
+/**
+ * @brief Сравнение set_boolean с ленивым перебором и потоковым выводом подмножеств
+ */
+void run_boolean_benchmark();
+
+/**
+ * @brief Замер ускорения parallel_engine при числе потоков от 1 до 16
+ */
+void run_parallel_benchmark();
+
+/**
+ * @brief Сравнение пропускной способности set_parser и string_validator на больших записях
+ */
+void run_parser_benchmark();
+
+/**
+ * @brief Замер разбора, печати, сравнения и удаления мелких и глубоко вложенных множеств
+ */
+void run_depth_benchmark();
+
+/**
+ * @brief Подсчет выделений памяти при разборе и удалении больших множеств
+ */
+void run_arena_benchmark();
+
+/**
+ * @brief Сравнение текстового и двоичного сохранения и загрузки тысяч множеств
+ */
+void run_serialize_benchmark();
+
+#endif //SEM3_L1_PPOIS_P2_BENCHMARKS_H
@@ -0,0 +1,79 @@
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include "benchmarks.h"
+#include "power_set.h"
+
+namespace {
+    /**
+     * Буфер потока, который только считает записанные символы.
+     */
+    class counting_buffer : public std::streambuf {
+    public:
+        size_t written = 0;
+
+    protected:
+        int_type overflow(int_type character) override {
+            written++;
+            return character;
+        }
+
+        std::streamsize xsputn(const char*, std::streamsize count) override {
+            written += static_cast<size_t>(count);
+            return count;
+        }
+    };
+
+    cantor_set letter_set(size_t element_number) {
+        std::string text = "{";
+        for (size_t i = 0; i < element_number; ++i) {
+            if (i < 26) text += static_cast<char>('a' + i);
+            else text += benchmark_element(i);
+        }
+        return cantor_set(text + "}");
+    }
+
+    void run_eager(size_t element_number) {
+        cantor_set set = letter_set(element_number);
+        size_t nodes_before = set_pool::instance().node_count();
+        size_t subset_number = 0;
+        size_t node_number = 0;
+        double seconds = measure_seconds([&] {
+            cantor_set boolean = set.set_boolean(set);
+            subset_number = boolean.set_length();
+            node_number = set_pool::instance().node_count() - nodes_before;
+        });
+        std::cout << "  set_boolean, n=" << element_number << ": " << seconds * 1000 << " мс, подмножеств "
+                  << subset_number << ", узлов в памяти " << node_number << "\n";
+    }
+
+    void run_lazy(size_t element_number) {
+        cantor_set set = letter_set(element_number);
+        size_t nodes_before = set_pool::instance().node_count();
+        power_set_generator generator(set);
+        size_t subset_number = 0;
+        size_t node_number = 0;
+        double next_seconds = measure_seconds([&] {
+            while (generator.has_next()) {
+                cantor_set subset = generator.next();
+                node_number = std::max(node_number, set_pool::instance().node_count() - nodes_before);
+                subset_number++;
+            }
+        });
+        counting_buffer buffer;
+        std::ostream output(&buffer);
+        double write_seconds = measure_seconds([&] { power_set_generator(set).write_to(output); });
+        std::cout << "  power_set_generator, n=" << element_number << ": next " << next_seconds * 1000
+                  << " мс (подмножеств " << subset_number << ", узлов в памяти не больше " << node_number
+                  << "), write_to " << write_seconds * 1000 << " мс (" << buffer.written / (1 << 20)
+                  << " МБ, " << buffer.written / write_seconds / (1 << 20) << " МБ/с)\n";
+    }
+}
+
+void run_boolean_benchmark() {
+    std::cout << "[boolean] булеан множества из n элементов\n";
+    run_eager(18);
+    run_lazy(18);
+    run_lazy(22);
+    std::cout << "  cardinality, n=63: " << power_set_generator(letter_set(63)).cardinality() << "\n";
+}
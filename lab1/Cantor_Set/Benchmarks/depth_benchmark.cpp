@@ -0,0 +1,39 @@
+#include <iostream>
+#include <string>
+#include "benchmarks.h"
+#include "set.h"
+
+namespace {
+    void run_case(const char* name, const std::string& text, size_t repeat_number) {
+        std::string other_text = text;
+        other_text[other_text.find_last_of("abcdefghijklmnopqrstuvwxyz")] = 'z';
+        size_t length = 0;
+        double parse_seconds = 0, print_seconds = 0, compare_seconds = 0, destroy_seconds = 0;
+        for (size_t i = 0; i < repeat_number; ++i) {
+            cantor_set* parsed = nullptr;
+            parse_seconds += measure_seconds([&] { parsed = new cantor_set(text); });
+            print_seconds += measure_seconds([&] { length += cantor_set::print_helper(*parsed).size(); });
+            cantor_set* other = new cantor_set(other_text);
+            compare_seconds += measure_seconds([&] {
+                length += set_pool::compare_elements(parsed->get_node(), other->get_node()) < 0;
+            });
+            delete other;
+            destroy_seconds += measure_seconds([&] { delete parsed; });
+        }
+        double scale = 1e3 / repeat_number;
+        std::cout << "  " << name << ": разбор " << parse_seconds * scale << " мс, печать " << print_seconds * scale
+                  << " мс, сравнение " << compare_seconds * scale << " мс, удаление " << destroy_seconds * scale
+                  << " мс (символов " << length << ")\n";
+    }
+}
+
+void run_depth_benchmark() {
+    std::cout << "[depth] разбор, печать, сравнение и удаление при разной глубине вложенности\n";
+    std::string shallow = "{";
+    for (size_t number = 0; number < 20000; ++number) shallow += benchmark_element(number);
+    shallow += "}";
+    run_case("20000 элементов глубины 4", shallow, 20);
+    const size_t depth = 100000;
+    std::string chain = std::string(depth, '{') + "a" + std::string(depth, '}');
+    run_case("цепочка глубины 100000", chain, 5);
+}
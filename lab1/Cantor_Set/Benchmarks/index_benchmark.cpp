@@ -0,0 +1,39 @@
+#include <iostream>
+#include <string>
+#include "benchmarks.h"
+#include "set.h"
+
+namespace {
+    void run_case(const char* name, char start_brace, size_t element_number) {
+        std::string text(1, start_brace);
+        for (size_t number = 0; number < element_number; ++number) text += benchmark_element(number);
+        text += start_brace == '{' ? '}' : '>';
+
+        cantor_set set(start_brace);
+        double parse_seconds = measure_seconds([&] { set = cantor_set(text); });
+        const size_t operation_number = 2000;
+        size_t found = 0;
+        double lookup_seconds = measure_seconds([&] {
+            for (size_t i = 0; i < operation_number; ++i) found += set[benchmark_element(i * 7)];
+        });
+        size_t changed = 0;
+        double add_seconds = measure_seconds([&] {
+            for (size_t i = 0; i < operation_number; ++i) changed += set.add_helper(benchmark_element(element_number + i));
+        });
+        double delete_seconds = measure_seconds([&] {
+            for (size_t i = 0; i < operation_number; ++i) changed += set.delete_helper(benchmark_element(i));
+        });
+        std::cout << "  " << name << ": разбор " << parse_seconds * 1000 << " мс, поиск "
+                  << lookup_seconds * 1e6 / operation_number << " мкс, добавление "
+                  << add_seconds * 1e6 / operation_number << " мкс, удаление "
+                  << delete_seconds * 1e6 / operation_number << " мкс (найдено " << found
+                  << ", изменено " << changed << ")\n";
+    }
+}
+
+void run_index_benchmark() {
+    const size_t element_number = 10000;
+    std::cout << "[index] множества из " << element_number << " вложенных элементов\n";
+    run_case("{}", '{', element_number);
+    run_case("<>", '<', element_number);
+}
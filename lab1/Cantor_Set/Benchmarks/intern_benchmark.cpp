@@ -0,0 +1,78 @@
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "benchmarks.h"
+#include "set.h"
+
+namespace {
+    /**
+     * Уровень k содержит два разных элемента: уровень k-1 и он же в ориентированном
+     * множестве, поэтому длина строки растет как 2^k, а различных узлов всего 2k.
+     */
+    std::string branching_set(size_t depth) {
+        std::string current = "{a}";
+        for (size_t level = 0; level < depth; ++level) current = "{" + current + "<" + current + ">}";
+        return current;
+    }
+
+    std::string chain_set(size_t depth) {
+        return std::string(depth, '{') + "a" + std::string(depth, '}');
+    }
+
+    size_t node_bytes(const set_node& node) {
+        const size_t control_block_bytes = 32;
+        const size_t pool_entry_bytes = 48;
+        return sizeof(set_node) + node.elements.capacity() * sizeof(set_element) + control_block_bytes + pool_entry_bytes;
+    }
+
+    void count_shared(const node_handle& node, std::unordered_map<const set_node*, size_t>& unshared_nodes,
+                      size_t& shared_bytes) {
+        if (unshared_nodes.count(node.get())) return;
+        size_t subtree_nodes = 1;
+        for (const set_element& current : node->elements) {
+            if (current.index() == 0) continue;
+            const node_handle& nested = std::get<1>(current);
+            count_shared(nested, unshared_nodes, shared_bytes);
+            subtree_nodes += unshared_nodes[nested.get()];
+        }
+        unshared_nodes[node.get()] = subtree_nodes;
+        shared_bytes += node_bytes(*node);
+    }
+
+    void run_case(const char* name, const std::string& text) {
+        size_t nodes_before = set_pool::instance().node_count();
+        cantor_set parsed('{');
+        double parse_seconds = measure_seconds([&] { parsed = cantor_set(text); });
+        cantor_set parsed_again('{');
+        double reparse_seconds = measure_seconds([&] { parsed_again = cantor_set(text); });
+
+        std::unordered_map<const set_node*, size_t> unshared_nodes;
+        size_t shared_bytes = 0;
+        count_shared(parsed.get_node(), unshared_nodes, shared_bytes);
+
+        const size_t copy_number = 1000000;
+        std::vector<cantor_set> copies;
+        copies.reserve(copy_number);
+        double copy_seconds = measure_seconds([&] {
+            for (size_t i = 0; i < copy_number; ++i) copies.push_back(parsed);
+        });
+        size_t equal = 0;
+        double compare_seconds = measure_seconds([&] {
+            for (size_t i = 0; i < copy_number; ++i) equal += parsed_again == copies[i];
+        });
+
+        std::cout << "  " << name << ": строка " << text.size() << " символов, узлов без разделения "
+                  << unshared_nodes[parsed.get_node().get()] << ", интернированных "
+                  << set_pool::instance().node_count() - nodes_before << " (~" << shared_bytes / 1024 << " КБ)\n"
+                  << "    разбор " << parse_seconds * 1000 << " мс, повторный разбор " << reparse_seconds * 1000
+                  << " мс, копирование " << copy_seconds * 1e9 / copy_number << " нс, сравнение "
+                  << compare_seconds * 1e9 / copy_number << " нс (равных " << equal << ")\n";
+    }
+}
+
+void run_intern_benchmark() {
+    std::cout << "[intern] глубоко вложенные множества\n";
+    run_case("ветвление, глубина 18", branching_set(18));
+    run_case("цепочка, глубина 5000", chain_set(5000));
+}
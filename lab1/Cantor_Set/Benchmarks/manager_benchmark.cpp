@@ -0,0 +1,58 @@
+#include <iostream>
+#include <string>
+#include "benchmarks.h"
+#include "set_manager.h"
+
+namespace {
+    std::string atom_set(size_t number, bool with_nested) {
+        std::string text = "{";
+        size_t state = number * 2654435761u + 1;
+        for (char atom = 'a'; atom <= 'z'; ++atom) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            if ((state >> 33) % 2) text += std::string(1, atom) + ",";
+        }
+        if (with_nested) text += benchmark_element(number % 7) + "," + benchmark_element(number % 5 + 7) + ",";
+        text.back() = '}';
+        return text;
+    }
+
+    void run_case(const char* name, bool with_nested) {
+        const size_t set_number = 200;
+        set_manager manager;
+        double create_seconds = measure_seconds([&] {
+            for (size_t i = 0; i < set_number; ++i) manager.create_set_help(atom_set(i, with_nested));
+        });
+        size_t count = manager.get_set_count();
+        size_t result_size = 0;
+        double union_seconds = measure_seconds([&] {
+            for (size_t i = 0; i < count; ++i)
+                for (size_t j = 0; j < count; ++j) result_size += manager.union_sets(i, j).set_length();
+        });
+        double intersection_seconds = measure_seconds([&] {
+            for (size_t i = 0; i < count; ++i)
+                for (size_t j = 0; j < count; ++j) result_size += manager.intersection_sets(i, j).set_length();
+        });
+        double difference_seconds = measure_seconds([&] {
+            for (size_t i = 0; i < count; ++i)
+                for (size_t j = 0; j < count; ++j) result_size += manager.difference_sets(i, j).set_length();
+        });
+        size_t found = 0;
+        double lookup_seconds = measure_seconds([&] {
+            for (size_t i = 0; i < count; ++i)
+                for (char atom = 'a'; atom <= 'z'; ++atom) found += manager.get_set(i)[std::string(1, atom)];
+        });
+        double operation_number = static_cast<double>(count * count);
+        std::cout << "  " << name << ": создание " << create_seconds * 1e6 / set_number << " мкс, объединение "
+                  << union_seconds * 1e9 / operation_number << " нс, пересечение "
+                  << intersection_seconds * 1e9 / operation_number << " нс, разность "
+                  << difference_seconds * 1e9 / operation_number << " нс, поиск буквы "
+                  << lookup_seconds * 1e9 / (count * 26) << " нс (элементов " << result_size
+                  << ", найдено " << found << ")\n";
+    }
+}
+
+void run_manager_benchmark() {
+    std::cout << "[manager] операции set_manager над всеми парами из 200 множеств\n";
+    run_case("только буквы", false);
+    run_case("буквы и вложенные", true);
+}
@@ -0,0 +1,53 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "benchmarks.h"
+#include "parallel_engine.h"
+#include "power_set.h"
+
+namespace {
+    cantor_set source_set(size_t element_number) {
+        std::string text = "{";
+        for (size_t i = 0; i < element_number; ++i) text += benchmark_element(i * 31);
+        return cantor_set(text + "}");
+    }
+
+    cantor_set numbered_set(size_t first, size_t last) {
+        std::string text = "{";
+        for (size_t number = first; number < last; ++number) text += benchmark_element(number);
+        return cantor_set(text + "}");
+    }
+}
+
+void run_parallel_benchmark() {
+    const size_t boolean_elements = 18;
+    const size_t stream_elements = 20;
+    const size_t operation_elements = 200000;
+    cantor_set boolean_source = source_set(boolean_elements);
+    cantor_set stream_source = source_set(stream_elements);
+    cantor_set first_set = numbered_set(0, operation_elements);
+    cantor_set second_set = numbered_set(operation_elements / 2, operation_elements * 3 / 2);
+
+    std::cout << "[parallel] ядер " << std::thread::hardware_concurrency() << "; булеан n=" << boolean_elements
+              << ", вывод булеана n=" << stream_elements << ", операции над множествами по "
+              << operation_elements << " элементов\n";
+    double base_seconds[4] = {};
+    for (size_t thread_number : {1, 2, 4, 8, 16}) {
+        parallel_engine engine(thread_number);
+        size_t check = 0;
+        double seconds[4];
+        seconds[0] = measure_seconds([&] { check += engine.power_set(boolean_source).set_length(); });
+        std::ostringstream output;
+        seconds[1] = measure_seconds([&] { engine.write_power_set(stream_source, output); });
+        check += output.str().size();
+        seconds[2] = measure_seconds([&] { check += engine.set_union(first_set, second_set).set_length(); });
+        seconds[3] = measure_seconds([&] { check += engine.set_intersection(first_set, second_set).set_length(); });
+        if (thread_number == 1) std::copy(seconds, seconds + 4, base_seconds);
+        std::cout << "  потоков " << thread_number << ": булеан " << seconds[0] * 1000 << " мс (x"
+                  << base_seconds[0] / seconds[0] << "), вывод " << seconds[1] * 1000 << " мс (x"
+                  << base_seconds[1] / seconds[1] << "), объединение " << seconds[2] * 1000 << " мс (x"
+                  << base_seconds[2] / seconds[2] << "), пересечение " << seconds[3] * 1000 << " мс (x"
+                  << base_seconds[3] / seconds[3] << "), контроль " << check << "\n";
+    }
+}
@@ -0,0 +1,38 @@
+#include <iostream>
+#include <string>
+#include "benchmarks.h"
+#include "set.h"
+#include "string_validator.h"
+
+namespace {
+    std::string generated_literal(size_t element_number) {
+        std::string text = "{";
+        for (size_t number = 0; number < element_number; ++number) {
+            text += number % 3 == 0 ? "<" + benchmark_element(number) + ", " + benchmark_element(number + 1) + ">"
+                                    : benchmark_element(number);
+            text += ", ";
+        }
+        text.resize(text.size() - 2);
+        return text + "}";
+    }
+
+    void run_case(size_t element_number) {
+        std::string text = generated_literal(element_number);
+        double megabytes = static_cast<double>(text.size()) / (1 << 20);
+        size_t length = 0;
+        double validator_seconds = measure_seconds([&] {
+            std::string validated = text;
+            if (string_validator::set_read(validated, false)) length += cantor_set(validated).set_length();
+        });
+        double parser_seconds = measure_seconds([&] { length += cantor_set::parse(text).set_length(); });
+        std::cout << "  " << element_number << " элементов, " << megabytes << " МБ: проверка и разбор "
+                  << megabytes / validator_seconds << " МБ/с, set_parser " << megabytes / parser_seconds
+                  << " МБ/с (ускорение " << validator_seconds / parser_seconds << "x, элементов " << length << ")\n";
+    }
+}
+
+void run_parser_benchmark() {
+    std::cout << "[parser] разбор больших записей множеств\n";
+    run_case(10000);
+    run_case(100000);
+}
@@ -0,0 +1,63 @@
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include "benchmarks.h"
+#include "set_manager.h"
+
+namespace {
+    std::string generated_set(size_t number, size_t element_number) {
+        std::string text = "{";
+        size_t state = number * 2654435761u + 1;
+        for (size_t i = 0; i < element_number; ++i) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            size_t value = (state >> 33) % 50000;
+            if (i % 10 == 0) text += static_cast<char>('a' + value % 26);
+            else if (i % 10 == 1) text += "<" + benchmark_element(value) + "," + benchmark_element(value + 1) + ">";
+            else text += benchmark_element(value);
+            text += ",";
+        }
+        text.back() = '}';
+        return text;
+    }
+}
+
+void run_serialize_benchmark() {
+    const size_t set_number = 2000;
+    const size_t element_number = 200;
+    std::cout << "[serialize] " << set_number << " множеств по " << element_number
+              << " элементов: текст через print_helper и разбор против двоичного формата\n";
+    auto manager = std::make_unique<set_manager>();
+    for (size_t i = 0; i < set_number; ++i) manager->create_set_help(generated_set(i, element_number));
+
+    std::string text;
+    double text_save_seconds = measure_seconds([&] {
+        for (const std::string& printed_set : manager->list_all_sets()) text += printed_set + "\n";
+    });
+    std::stringstream binary(std::ios::in | std::ios::out | std::ios::binary);
+    double binary_save_seconds = measure_seconds([&] { manager->save(binary); });
+    std::string binary_data = binary.str();
+    manager.reset();
+
+    auto loaded = std::make_unique<set_manager>();
+    double text_load_seconds = measure_seconds([&] {
+        std::istringstream input(text);
+        std::string line;
+        while (std::getline(input, line)) loaded->create_set_help(line);
+    });
+    size_t text_count = loaded->get_set_count();
+    loaded = std::make_unique<set_manager>();
+    size_t binary_count = 0;
+    double binary_load_seconds = measure_seconds([&] {
+        std::istringstream input(binary_data, std::ios::binary);
+        binary_count = loaded->load(input);
+    });
+
+    std::cout << "  размер: текст " << text.size() / 1024 << " КБ, двоичный " << binary_data.size() / 1024 << " КБ\n"
+              << "  сохранение: текст " << text_save_seconds * 1000 << " мс, двоичный " << binary_save_seconds * 1000
+              << " мс (" << text_save_seconds / binary_save_seconds << "x)\n"
+              << "  загрузка: текст " << text_load_seconds * 1000 << " мс, двоичный " << binary_load_seconds * 1000
+              << " мс (" << text_load_seconds / binary_load_seconds << "x)\n"
+              << "  полный цикл: " << (text_save_seconds + text_load_seconds) / (binary_save_seconds + binary_load_seconds)
+              << "x (множеств " << text_count << " и " << binary_count << ")\n";
+}
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <thread>
+#include "parallel_engine.h"
+#include "power_set.h"
+
+parallel_engine::parallel_engine(size_t threads)
+        : thread_number(threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : threads) {}
+
+size_t parallel_engine::get_thread_number() const {
+    return thread_number;
+}
+
+void parallel_engine::run_segments(size_t segment_number, const std::function<void(size_t)>& process_segment) const {
+    std::atomic<size_t> next_segment(0);
+    std::exception_ptr first_exception;
+    std::atomic<bool> has_exception(false);
+    auto worker = [&]() {
+        for (size_t index = next_segment++; index < segment_number; index = next_segment++) {
+            try {
+                process_segment(index);
+            } catch (...) {
+                if (!has_exception.exchange(true)) first_exception = std::current_exception();
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < std::min(thread_number, segment_number); ++i) workers.emplace_back(worker);
+    worker();
+    for (std::thread& current_thread : workers) current_thread.join();
+    if (first_exception) std::rethrow_exception(first_exception);
+}
+
+std::vector<set_element> parallel_engine::filter(const std::vector<set_element>& elements, const set_node& other_node,
+                                                 bool keep_found) const {
+    size_t segment_number = elements.size() < parallel_threshold ? 1 : thread_number * segments_per_thread;
+    size_t segment_size = (elements.size() + segment_number - 1) / segment_number;
+    std::vector<std::vector<set_element>> partial_results(segment_number);
+    run_segments(segment_number, [&](size_t index) {
+        size_t first = std::min(elements.size(), index * segment_size);
+        size_t last = std::min(elements.size(), first + segment_size);
+        for (size_t i = first; i < last; ++i) {
+            if ((other_node.find(elements[i]) != -1) == keep_found) partial_results[index].push_back(elements[i]);
+        }
+    });
+    std::vector<set_element> result;
+    size_t result_size = 0;
+    for (const auto& partial_result : partial_results) result_size += partial_result.size();
+    result.reserve(result_size);
+    for (auto& partial_result : partial_results) {
+        std::move(partial_result.begin(), partial_result.end(), std::back_inserter(result));
+    }
+    return result;
+}
+
+cantor_set parallel_engine::power_set(const cantor_set &source_set) const {
+    power_set_generator generator(source_set);
+    uint64_t total = generator.cardinality();
+    size_t segment_number = static_cast<size_t>(std::min<uint64_t>(total, thread_number * segments_per_thread));
+    uint64_t segment_size = (total + segment_number - 1) / segment_number;
+    std::vector<std::vector<set_element>> partial_results(segment_number);
+    run_segments(segment_number, [&](size_t index) {
+        uint64_t first_step = std::min(total, index * segment_size);
+        generator.collect_range(first_step, std::min(total, first_step + segment_size), partial_results[index]);
+    });
+    std::vector<set_element> subsets;
+    subsets.reserve(static_cast<size_t>(total));
+    for (auto& partial_result : partial_results) {
+        std::move(partial_result.begin(), partial_result.end(), std::back_inserter(subsets));
+        partial_result = std::vector<set_element>();
+    }
+    return cantor_set(set_pool::instance().intern(false, std::move(subsets)));
+}
+
+void parallel_engine::write_power_set(const cantor_set &source_set, std::ostream &output) const {
+    power_set_generator generator(source_set);
+    uint64_t total = generator.cardinality();
+    size_t round_segments = thread_number * segments_per_thread;
+    std::vector<std::string> buffers(round_segments);
+    output << '{';
+    for (uint64_t round_start = 0; round_start < total; round_start += round_segments * subsets_per_segment) {
+        run_segments(round_segments, [&](size_t index) {
+            uint64_t first_step = std::min(total, round_start + index * subsets_per_segment);
+            generator.write_range(first_step, std::min(total, first_step + subsets_per_segment), buffers[index]);
+        });
+        for (std::string& buffer : buffers) {
+            output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+    output << '}';
+}
+
+cantor_set parallel_engine::set_union(const cantor_set &first_set, const cantor_set &second_set) const {
+    if (first_set.is_directed_set()) {
+        cantor_set result = first_set;
+        cantor_set other_set = second_set;
+        return result += other_set;
+    }
+    cantor_set::vec_element other_storage;
+    const cantor_set::vec_element &other_elements = cantor_set::canonical_elements(second_set.root, other_storage);
+    std::vector<set_element> added = filter(other_elements, *first_set.root, false);
+    std::vector<set_element> elements;
+    elements.reserve(first_set.root->elements.size() + added.size());
+    std::merge(first_set.root->elements.begin(), first_set.root->elements.end(), added.begin(), added.end(),
+               std::back_inserter(elements), set_pool::element_less);
+    return cantor_set(set_pool::instance().intern(false, std::move(elements)));
+}
+
+cantor_set parallel_engine::set_intersection(const cantor_set &first_set, const cantor_set &second_set) const {
+    cantor_set::vec_element own_storage;
+    const cantor_set::vec_element &own_elements = cantor_set::canonical_elements(first_set.root, own_storage);
+    return cantor_set(set_pool::instance().intern(false, filter(own_elements, *second_set.root, true)));
+}
+
+cantor_set parallel_engine::set_difference(const cantor_set &first_set, const cantor_set &second_set) const {
+    cantor_set::vec_element own_storage;
+    const cantor_set::vec_element &own_elements = cantor_set::canonical_elements(first_set.root, own_storage);
+    return cantor_set(set_pool::instance().intern(false, filter(own_elements, *second_set.root, false)));
+}
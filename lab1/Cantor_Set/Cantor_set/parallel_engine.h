@@ -0,0 +1,110 @@
+/**
+ * @file parallel_engine.h
+ * @brief Заголовочный файл многопоточного выполнения тяжелых операций над множествами
+ * @author Ященко Александра
+ */
+
+#ifndef SEM3_L1_PPOIS_P2_PARALLEL_ENGINE_H
+#define SEM3_L1_PPOIS_P2_PARALLEL_ENGINE_H
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include "set.h"
+
+/**
+ * @brief Многопоточное построение булеана и операции над большими множествами
+ *
+ * @details Работа делится на части, примерно по segments_per_thread на поток; потоки
+ * берут части по очереди из общего счетчика, вызывающий поток тоже участвует.
+ * Результаты частей всегда склеиваются в порядке частей, поэтому результат не
+ * зависит от количества потоков и совпадает с последовательными операциями.
+ *
+ * Булеан делится по номерам подмножеств (шагам кода Грея power_set_generator):
+ * каждая часть строит или печатает свой диапазон в собственный буфер.
+ * В операциях над неориентированными множествами элементы делятся на непрерывные
+ * диапазоны канонического порядка, а принадлежность другому множеству проверяется
+ * по его хеш-индексу, поэтому результат частей уже упорядочен.
+ */
+class parallel_engine {
+private:
+    static constexpr size_t segments_per_thread = 8; ///< Количество частей на поток
+    static constexpr uint64_t subsets_per_segment = 4096; ///< Подмножеств в части при выводе булеана
+    static constexpr size_t parallel_threshold = 2048; ///< Размер множеств, начиная с которого операции делятся
+
+    size_t thread_number; ///< Количество потоков
+
+    /**
+     * @brief Выполняет части работы в нескольких потоках
+     * @param segment_number Количество частей
+     * @param process_segment Функция обработки части по номеру
+     * @throw Первое исключение, выброшенное process_segment
+     */
+    void run_segments(size_t segment_number, const std::function<void(size_t)>& process_segment) const;
+
+    /**
+     * @brief Фильтрует элементы по принадлежности другому множеству
+     * @param elements Элементы в каноническом порядке
+     * @param other_node Узел множества, принадлежность которому проверяется
+     * @param keep_found true - оставить найденные элементы, false - ненайденные
+     * @return Оставленные элементы в исходном порядке
+     */
+    std::vector<set_element> filter(const std::vector<set_element>& elements, const set_node& other_node,
+                                    bool keep_found) const;
+
+public:
+    /**
+     * @brief Конструктор
+     * @param threads Количество потоков, 0 - по числу ядер
+     */
+    explicit parallel_engine(size_t threads = 0);
+
+    /**
+     * @brief Возвращает количество потоков
+     * @return Количество потоков
+     */
+    size_t get_thread_number() const;
+
+    /**
+     * @brief Строит булеан множества
+     * @param source_set Исходное множество
+     * @return Множество всех подмножеств, равное cantor_set::set_boolean
+     * @throw std::overflow_error если множество содержит 64 и более элементов
+     */
+    cantor_set power_set(const cantor_set&) const;
+
+    /**
+     * @brief Выводит булеан множества в поток
+     * @param source_set Исходное множество
+     * @param output Поток вывода
+     * @details Вывод совпадает с power_set_generator::write_to. Части печатаются
+     * порциями по segments_per_thread частей на поток, поэтому память ограничена.
+     */
+    void write_power_set(const cantor_set&, std::ostream&) const;
+
+    /**
+     * @brief Объединение множеств
+     * @param first_set Первое множество
+     * @param second_set Второе множество
+     * @return Результат, равный first_set + second_set
+     */
+    cantor_set set_union(const cantor_set&, const cantor_set&) const;
+
+    /**
+     * @brief Пересечение множеств
+     * @param first_set Первое множество
+     * @param second_set Второе множество
+     * @return Результат, равный first_set * second_set
+     */
+    cantor_set set_intersection(const cantor_set&, const cantor_set&) const;
+
+    /**
+     * @brief Разность множеств
+     * @param first_set Уменьшаемое
+     * @param second_set Вычитаемое
+     * @return Результат, равный first_set - second_set
+     */
+    cantor_set set_difference(const cantor_set&, const cantor_set&) const;
+};
+
+#endif //SEM3_L1_PPOIS_P2_PARALLEL_ENGINE_H
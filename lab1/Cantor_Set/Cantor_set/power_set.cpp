@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <stdexcept>
+#include "power_set.h"
+
+power_set_generator::power_set_generator(const cantor_set &source_set) {
+    cantor_set::vec_element storage;
+    elements = cantor_set::canonical_elements(source_set.root, storage);
+    chosen.assign(elements.size(), false);
+    printed_elements.resize(elements.size());
+    for (size_t i = 0; i < elements.size(); ++i) {
+        source_set.print_set(elements[i], printed_elements[i]);
+        printed_elements[i].pop_back();
+    }
+}
+
+size_t power_set_generator::flip_position(uint64_t current_step) {
+    size_t position = 0;
+    while (!((current_step >> position) & 1)) position++;
+    return position;
+}
+
+std::vector<bool> power_set_generator::gray_flags(uint64_t current_step) const {
+    uint64_t gray_code = current_step ^ (current_step >> 1);
+    std::vector<bool> flags(elements.size(), false);
+    for (size_t i = 0; i < elements.size() && i < 64; ++i) flags[i] = (gray_code >> i) & 1;
+    return flags;
+}
+
+bool power_set_generator::has_next() const {
+    return elements.size() >= 64 || step < (uint64_t(1) << elements.size());
+}
+
+cantor_set power_set_generator::next() {
+    if (!has_next()) throw std::out_of_range("Все подмножества уже получены");
+    if (step > 0) {
+        changed = flip_position(step);
+        chosen[changed] = !chosen[changed];
+    }
+    step++;
+    cantor_set::vec_element subset;
+    for (size_t i = 0; i < elements.size(); ++i) {
+        if (chosen[i]) subset.push_back(elements[i]);
+    }
+    return cantor_set(set_pool::instance().intern(false, std::move(subset)));
+}
+
+size_t power_set_generator::changed_position() const {
+    return changed;
+}
+
+uint64_t power_set_generator::cardinality() const {
+    if (elements.size() >= 64) throw std::overflow_error("Количество подмножеств не помещается в 64 бита");
+    return uint64_t(1) << elements.size();
+}
+
+void power_set_generator::write_to(std::ostream &output) const {
+    const uint64_t block_size = 4096;
+    uint64_t total = cardinality();
+    std::string buffer = "{";
+    for (uint64_t first_step = 0; first_step < total; first_step += block_size) {
+        write_range(first_step, std::min(total, first_step + block_size), buffer);
+        output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+    output << '}';
+}
+
+void power_set_generator::write_range(uint64_t first_step, uint64_t last_step, std::string &buffer) const {
+    std::vector<bool> current = gray_flags(first_step);
+    for (uint64_t current_step = first_step; current_step < last_step; ++current_step) {
+        if (current_step > 0) buffer += ',';
+        if (current_step > first_step) {
+            size_t position = flip_position(current_step);
+            current[position] = !current[position];
+        }
+        buffer += '{';
+        bool is_first = true;
+        for (size_t i = 0; i < elements.size(); ++i) {
+            if (!current[i]) continue;
+            if (!is_first) buffer += ',';
+            buffer += printed_elements[i];
+            is_first = false;
+        }
+        buffer += '}';
+    }
+}
+
+void power_set_generator::collect_range(uint64_t first_step, uint64_t last_step, std::vector<set_element> &subsets) const {
+    std::vector<bool> current = gray_flags(first_step);
+    set_pool& pool = set_pool::instance();
+    for (uint64_t current_step = first_step; current_step < last_step; ++current_step) {
+        if (current_step > first_step) {
+            size_t position = flip_position(current_step);
+            current[position] = !current[position];
+        }
+        std::vector<set_element> subset;
+        for (size_t i = 0; i < elements.size(); ++i) {
+            if (current[i]) subset.push_back(elements[i]);
+        }
+        subsets.emplace_back(pool.intern(false, std::move(subset)));
+    }
+}
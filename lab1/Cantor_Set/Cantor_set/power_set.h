@@ -0,0 +1,110 @@
+/**
+ * @file power_set.h
+ * @brief Заголовочный файл генератора подмножеств (булеана) канторовского множества
+ * @author Ященко Александра
+ */
+
+#ifndef SEM3_L1_PPOIS_P2_POWER_SET_H
+#define SEM3_L1_PPOIS_P2_POWER_SET_H
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "set.h"
+
+/**
+ * @brief Генератор подмножеств множества по требованию
+ *
+ * @details Подмножества выдаются в порядке кода Грея: каждое следующее отличается от
+ * предыдущего ровно одним элементом. Генератор хранит только элементы исходного
+ * множества в каноническом порядке и флаги их выбора, поэтому его память O(n)
+ * независимо от количества подмножеств. Как и в cantor_set::set_boolean, все
+ * подмножества неориентированные.
+ */
+class power_set_generator {
+private:
+    std::vector<set_element> elements; ///< Элементы исходного множества в каноническом порядке
+    std::vector<std::string> printed_elements; ///< Строковые представления элементов для вывода
+    std::vector<bool> chosen; ///< Флаги элементов, входящих в текущее подмножество
+    uint64_t step = 0; ///< Количество выданных подмножеств
+    size_t changed = SIZE_MAX; ///< Позиция элемента, измененного последним шагом
+
+    /**
+     * @brief Находит элемент, меняющийся на шаге перебора
+     * @param current_step Номер шага, больше нуля
+     * @return Номер младшего единичного бита current_step
+     */
+    static size_t flip_position(uint64_t);
+
+    /**
+     * @brief Восстанавливает флаги выбора по номеру шага
+     * @param current_step Номер шага
+     * @return Флаги элементов подмножества с кодом Грея current_step
+     */
+    std::vector<bool> gray_flags(uint64_t) const;
+
+public:
+    /**
+     * @brief Конструктор
+     * @param source_set Множество, подмножества которого нужно получить
+     */
+    explicit power_set_generator(const cantor_set&);
+
+    /**
+     * @brief Проверяет, остались ли невыданные подмножества
+     * @return true, если next можно вызвать еще раз
+     * @details У множеств из 64 и более элементов перебор практически бесконечен,
+     * и метод всегда возвращает true.
+     */
+    bool has_next() const;
+
+    /**
+     * @brief Выдает следующее подмножество
+     * @return Подмножество; первым выдается пустое множество
+     * @throw std::out_of_range если все подмножества уже выданы
+     */
+    cantor_set next();
+
+    /**
+     * @brief Возвращает позицию элемента, измененного последним вызовом next
+     * @return Позиция в каноническом порядке или SIZE_MAX, если подмножество одно или пустое
+     */
+    size_t changed_position() const;
+
+    /**
+     * @brief Возвращает количество подмножеств без их построения
+     * @return 2 в степени количества элементов
+     * @throw std::overflow_error если результат не помещается в 64 бита
+     */
+    uint64_t cardinality() const;
+
+    /**
+     * @brief Выводит весь булеан в поток, не создавая подмножеств
+     * @param output Поток вывода
+     * @details Формат совпадает с cantor_set::print_helper, подмножества идут в порядке
+     * кода Грея. Состояние генератора не меняется.
+     * @throw std::overflow_error если элементов 64 или больше; в поток при этом ничего не выводится
+     */
+    void write_to(std::ostream&) const;
+
+    /**
+     * @brief Дописывает в строку подмножества с номерами шагов из диапазона
+     * @param first_step Первый шаг
+     * @param last_step Шаг после последнего
+     * @param buffer Строка для вывода; перед каждым подмножеством, кроме нулевого, ставится ','
+     * @details Диапазоны можно выводить независимо, например в разных потоках, а затем
+     * склеить по порядку.
+     */
+    void write_range(uint64_t, uint64_t, std::string&) const;
+
+    /**
+     * @brief Дописывает в вектор подмножества с номерами шагов из диапазона
+     * @param first_step Первый шаг
+     * @param last_step Шаг после последнего
+     * @param subsets Вектор для интернированных подмножеств
+     */
+    void collect_range(uint64_t, uint64_t, std::vector<set_element>&) const;
+};
+
+#endif //SEM3_L1_PPOIS_P2_POWER_SET_H
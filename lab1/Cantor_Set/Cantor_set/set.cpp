@@ -1,84 +1,78 @@
+#include <algorithm>
+#include <bitset>
 #include <iostream>
+#include <iterator>
 #include <string>
+#include <utility>
 #include <variant>
 #include "set.h"
-#include "string_validator.h"
-
-cantor_set cantor_set::initialize_set_elems(const std::string &elements_string,const char &start_brace ,size_t &position) {
-    cantor_set set_to_initialize(elements_string[0]);
-    char end_brace = (start_brace == '{') ? '}' : '>';
-    set_to_initialize.is_directed = start_brace != '{';
-    while (position < elements_string.size() && elements_string[position] != end_brace) {
-        if (elements_string[position] == '{' || elements_string[position] == '<') {
-            position++;
-            cantor_set nested_set(elements_string[position-1]);
-            nested_set = initialize_set_elems(elements_string, elements_string[position-1], position);
-            if(find_element(set_to_initialize, nested_set)==-1)
-                set_to_initialize.set_elements.emplace_back(nested_set);
-        } else {
-            if(find_element(set_to_initialize, elements_string[position])==-1)
-                set_to_initialize.set_elements.emplace_back(elements_string[position]);
+#include "set_parser.h"
+
+namespace {
+    /**
+     * Если буквы обоих неориентированных множеств описываются масками, буквенная часть
+     * результата вычисляется одной битовой операцией, а слиянием обрабатываются только
+     * вложенные множества.
+     */
+    template<typename atom_operation, typename merge_operation>
+    bool combine_with_masks(const set_node& first_node, const set_node& second_node, std::vector<set_element>& elements,
+                            atom_operation atoms, merge_operation merge) {
+        if (!first_node.has_mask_atoms() || !second_node.has_mask_atoms()) return false;
+        uint32_t atom_mask = atoms(first_node.atom_mask, second_node.atom_mask);
+        elements.reserve(std::bitset<32>(atom_mask).count() + first_node.elements.size() - first_node.atom_number +
+                         second_node.elements.size() - second_node.atom_number);
+        for (char atom = 'a'; atom <= 'z'; ++atom) {
+            if (atom_mask & (1u << (atom - 'a'))) elements.emplace_back(atom);
         }
-        position++;
-    }
-    return set_to_initialize;
-}
-
-bool cantor_set::compare_elems(const element &first_elem, const element &second_elem) const {
-    if (first_elem.index() == 0 && second_elem.index() == 0)
-        return std::get<0>(first_elem) == std::get<0>(second_elem);
-    else if (first_elem.index() != second_elem.index()) return false;
-    else {
-        cantor_set first_set=std::get<1>(first_elem);
-        cantor_set second_set=std::get<1>(second_elem);
-        if (first_set.set_elements.size() != second_set.set_elements.size() ||
-            first_set.is_directed != second_set.is_directed) return false;
-        return compare_sets(first_set, second_set);
+        merge(first_node.elements.begin() + first_node.atom_number, first_node.elements.end(),
+              second_node.elements.begin() + second_node.atom_number, second_node.elements.end(),
+              std::back_inserter(elements), set_pool::element_less);
+        return true;
     }
 }
 
-bool cantor_set::compare_sets(const cantor_set &first_set, const cantor_set &second_set) const {
-    if (first_set.is_directed){
-        for (size_t i = 0; i < first_set.set_elements.size(); ++i) {
-            if(!compare_elems(first_set.set_elements[i],
-                              second_set.set_elements[i])) return false;
-        }
-    }else{
-        for (const element &first_current: first_set.set_elements){
-            bool element_is_equal = false;
-            for (const element &second_current : second_set.set_elements){
-                element_is_equal=compare_elems(first_current, second_current);
-                if(element_is_equal) break;
-            }
-            if (!element_is_equal) return false;
+node_handle cantor_set::initialize_set_elems(const std::string &elements_string,const char &start_brace ,size_t &position) {
+    set_builder builder;
+    builder.open(start_brace != '{');
+    for (; position < elements_string.size(); ++position) {
+        char current = elements_string[position];
+        if (current == '{' || current == '<') {
+            builder.open(current == '<');
+        } else if (current == (builder.is_directed() ? '>' : '}')) {
+            if (builder.depth() == 1) return builder.close();
+            builder.close();
+        } else {
+            builder.add_atom(current);
         }
     }
-    return true;
-}
-
-int cantor_set::find_element(const cantor_set &cantor_set_, const std::string &input_string){
-    element elem_to_find=element_initializer(input_string);
-    return find_element(cantor_set_, elem_to_find);
+    node_handle node;
+    while (builder.depth() > 0) node = builder.close();
+    return node;
 }
 
 int cantor_set::find_element(const std::string &input_string){
-    return find_element(*this, input_string);
+    element elem_to_find=element_initializer(input_string);
+    return find_element(elem_to_find);
 }
 
 int cantor_set::find_element(const element &elem_to_find){
-    return find_element(*this, elem_to_find);
+    return root->find(elem_to_find);
 }
 
-int cantor_set::find_element(const cantor_set &cantor_set_, const element &elem_to_find) {
-    for (size_t i = 0; i < cantor_set_.set_elements.size(); ++i){
-        if(compare_elems(cantor_set_.set_elements[i], elem_to_find)) return i;
-    }
-    return -1;
+const cantor_set::vec_element& cantor_set::canonical_elements(const node_handle &node, vec_element &storage) {
+    if (!node->is_directed) return node->elements;
+    storage = node->elements;
+    std::sort(storage.begin(), storage.end(), set_pool::element_less);
+    return storage;
 }
 
 bool cantor_set::add_element(const element &elem_to_add){
     if(find_element(elem_to_add)!=-1) return false;
-    set_elements.push_back(elem_to_add);
+    vec_element elements = root->elements;
+    if (root->is_directed) elements.push_back(elem_to_add);
+    else elements.insert(std::upper_bound(elements.begin(), elements.end(), elem_to_add, set_pool::element_less),
+                         elem_to_add);
+    root = set_pool::instance().intern(root->is_directed, std::move(elements));
     return true;
 }
 
@@ -87,17 +81,15 @@ bool cantor_set::add_helper(const std::string& string_to_add){
         element elem_to_add = string_to_add[0];
         return add_element(elem_to_add);
     }
-    std::string new_string_to_add=string_to_add;
-    if(!string_validator::set_read(new_string_to_add, true))
-        throw std::invalid_argument("Элемент введен неверно");
-    element elem_to_add = element_initializer(new_string_to_add);
-    return add_element(elem_to_add);
+    return add_element(set_parser::parse_element(string_to_add));
 }
 
 bool cantor_set::delete_element(const element &elem_to_delete){
     int position=find_element(elem_to_delete);
     if(position==-1) return false;
-    set_elements.erase(set_elements.begin() + position);
+    vec_element elements = root->elements;
+    elements.erase(elements.begin() + position);
+    root = set_pool::instance().intern(root->is_directed, std::move(elements));
     return true;
 }
 
@@ -106,38 +98,34 @@ bool cantor_set::delete_helper(const std::string& string_to_delete){
         element elem_to_delete = string_to_delete[0];
         return delete_element(elem_to_delete);
     }
-    std::string new_string_to_delete=string_to_delete;
-    if(!string_validator::set_read(new_string_to_delete, true))
-        throw std::invalid_argument("Элемент введен неверно");
-    element elem_to_delete = element_initializer(new_string_to_delete);
-    return delete_element(elem_to_delete);
+    return delete_element(set_parser::parse_element(string_to_delete));
 }
 
-cantor_set::cantor_set(const char start_brace) {
-    start_brace == '{' ? is_directed = false : is_directed = true;
-}
+cantor_set::cantor_set(node_handle node) : root(std::move(node)) {}
 
-cantor_set::cantor_set(const std::string& elements_string) {
-    elements_string[0] == '{' ? is_directed = false : is_directed = true;
-    *this = std::get<1>(element_initializer(elements_string));
-}
+cantor_set::cantor_set(const char start_brace)
+        : root(set_pool::instance().intern(start_brace != '{', vec_element())) {}
+
+cantor_set::cantor_set(const std::string& elements_string)
+        : root(std::get<1>(element_initializer(elements_string))) {}
+
+cantor_set::cantor_set(const char* elements_string)
+        : root(std::get<1>(element_initializer(elements_string))) {}
+
+cantor_set::cantor_set(const cantor_set &other_set) = default;
+
+cantor_set& cantor_set::operator=(const cantor_set &other_set) = default;
 
-cantor_set::cantor_set(const char* elements_string) {
-    elements_string[0] == '{' ? is_directed = false : is_directed = true;
-    *this = std::get<1>(element_initializer(elements_string));
+cantor_set cantor_set::parse(std::string_view text) {
+    return cantor_set(set_parser::parse_set(text));
 }
 
-cantor_set::cantor_set(const cantor_set &other_set) {
-    is_directed = other_set.is_directed;
-    set_elements = other_set.set_elements;
+const node_handle& cantor_set::get_node() const {
+    return root;
 }
 
-cantor_set& cantor_set::operator=(const cantor_set &other_set) {
-    if (this != &other_set) {
-        this->is_directed = other_set.is_directed;
-        this->set_elements = other_set.set_elements;
-    }
-    return *this;
+size_t cantor_set::get_hash() const {
+    return root->structural_hash;
 }
 
 cantor_set::element cantor_set::element_initializer(const std::string &input_string){
@@ -152,19 +140,19 @@ cantor_set::element cantor_set::element_initializer(const std::string &input_str
 }
 
 bool cantor_set::is_empty(){
-    return set_elements.empty();
+    return root->elements.empty();
 }
 
 bool cantor_set::is_directed_set() const{
-    return is_directed;
+    return root->is_directed;
 }
 
 size_t cantor_set::set_length() {
-    return set_elements.size();
+    return root->elements.size();
 }
 
 bool cantor_set::operator==(const cantor_set &other_set) const {
-    return compare_elems(other_set, *this);
+    return set_pool::nodes_equal(root, other_set.root);
 }
 
 bool cantor_set::operator!=(const cantor_set &other_set) const{
@@ -174,22 +162,37 @@ bool cantor_set::operator!=(const cantor_set &other_set) const{
 std::string cantor_set::print_set(const element &elem_to_print, std::string& printed_set) const {
     if (elem_to_print.index() == 0) {
         printed_set+=std::get<0>(elem_to_print);
-    } else {
-        cantor_set set_to_print=std::get<1>(elem_to_print);
-        (set_to_print.is_directed_set()) ? printed_set+='<' : printed_set+='{';
-        for (const element &current_element: std::get<1>(elem_to_print).set_elements) {
-            printed_set=print_set(current_element,printed_set);
+        printed_set+=',';
+        return printed_set;
+    }
+    std::vector<std::pair<const set_node*, size_t>> unfinished;
+    unfinished.emplace_back(std::get<1>(elem_to_print).get(), 0);
+    printed_set += std::get<1>(elem_to_print)->is_directed ? '<' : '{';
+    while (!unfinished.empty()) {
+        auto &[node_to_print, position] = unfinished.back();
+        if (position == node_to_print->elements.size()) {
+            if(printed_set[printed_set.size() - 1]==',') printed_set.pop_back();
+            printed_set += node_to_print->is_directed ? '>' : '}';
+            printed_set += ',';
+            unfinished.pop_back();
+            continue;
+        }
+        const element &current_element = node_to_print->elements[position++];
+        if (current_element.index() == 0) {
+            printed_set += std::get<0>(current_element);
+            printed_set += ',';
+        } else {
+            const set_node* nested_node = std::get<1>(current_element).get();
+            printed_set += nested_node->is_directed ? '<' : '{';
+            unfinished.emplace_back(nested_node, 0);
         }
-        if(printed_set[printed_set.size() - 1]==',') printed_set.pop_back();
-        (set_to_print.is_directed_set()) ? printed_set+='>' : printed_set+='}';
     }
-    printed_set+=',';
     return printed_set;
 }
 
 std::string cantor_set::print_helper(const cantor_set &set_to_print){
     std::string printed_set;
-    printed_set=set_to_print.print_set(set_to_print, printed_set);
+    set_to_print.print_set(set_to_print.root, printed_set);
     if(printed_set[printed_set.size() - 1]==',') printed_set.pop_back();
     return printed_set;
 }
@@ -198,16 +201,26 @@ bool cantor_set::operator[](const std::string &input_string) {
     if (input_string.length() == 1 && input_string[0] >= 'a' && input_string[0] <= 'z') {
         return find_element(input_string) != -1;
     }
-    std::string new_input_string=input_string;
-    if(!string_validator::set_read(new_input_string, true))
-        throw std::invalid_argument("Элемент введен неверно");
-    return find_element(new_input_string) != -1;
+    return find_element(set_parser::parse_element(input_string)) != -1;
 }
 
 cantor_set& cantor_set::operator+=(cantor_set& other_set) {
-    for (const auto &current_element: other_set.set_elements) {
-        if (find_element(current_element) == -1) set_elements.push_back(current_element);
+    vec_element elements;
+    if (root->is_directed) {
+        elements = root->elements;
+        for (const auto &current_element: other_set.root->elements) {
+            if (root->find(current_element) == -1) elements.push_back(current_element);
+        }
+    } else if (!combine_with_masks(*root, *other_set.root, elements,
+                                   [](uint32_t first, uint32_t second) { return first | second; },
+                                   [](auto... arguments) { return std::set_union(arguments...); })) {
+        vec_element other_storage;
+        const vec_element &other_elements = canonical_elements(other_set.root, other_storage);
+        elements.reserve(root->elements.size() + other_elements.size());
+        std::set_union(root->elements.begin(), root->elements.end(), other_elements.begin(), other_elements.end(),
+                       std::back_inserter(elements), set_pool::element_less);
     }
+    root = set_pool::instance().intern(root->is_directed, std::move(elements));
     return *this;
 }
 
@@ -218,12 +231,17 @@ cantor_set cantor_set::operator+(cantor_set& other_set) {
 }
 
 cantor_set& cantor_set::operator*=(cantor_set& other_set) {
-    cantor_set result_set('{');
-    for (const auto &current_element: set_elements) {
-        if (find_element(other_set, current_element) != -1)
-            result_set.set_elements.push_back(current_element);
+    vec_element elements;
+    if (!combine_with_masks(*root, *other_set.root, elements,
+                            [](uint32_t first, uint32_t second) { return first & second; },
+                            [](auto... arguments) { return std::set_intersection(arguments...); })) {
+        vec_element own_storage, other_storage;
+        const vec_element &own_elements = canonical_elements(root, own_storage);
+        const vec_element &other_elements = canonical_elements(other_set.root, other_storage);
+        std::set_intersection(own_elements.begin(), own_elements.end(), other_elements.begin(), other_elements.end(),
+                              std::back_inserter(elements), set_pool::element_less);
     }
-    *this=result_set;
+    root = set_pool::instance().intern(false, std::move(elements));
     return *this;
 }
 
@@ -234,12 +252,17 @@ cantor_set cantor_set::operator*(cantor_set& other_set) {
 }
 
 cantor_set& cantor_set::operator-=(cantor_set& other_set) {
-    cantor_set result_set('{');
-    for (const auto &current_element: set_elements) {
-        if (find_element(other_set, current_element) == -1)
-            result_set.set_elements.push_back(current_element);
+    vec_element elements;
+    if (!combine_with_masks(*root, *other_set.root, elements,
+                            [](uint32_t first, uint32_t second) { return first & ~second; },
+                            [](auto... arguments) { return std::set_difference(arguments...); })) {
+        vec_element own_storage, other_storage;
+        const vec_element &own_elements = canonical_elements(root, own_storage);
+        const vec_element &other_elements = canonical_elements(other_set.root, other_storage);
+        std::set_difference(own_elements.begin(), own_elements.end(), other_elements.begin(), other_elements.end(),
+                            std::back_inserter(elements), set_pool::element_less);
     }
-    *this=result_set;
+    root = set_pool::instance().intern(false, std::move(elements));
     return *this;
 }
 
@@ -250,18 +273,18 @@ cantor_set cantor_set::operator-(cantor_set& other_set) {
 }
 
 cantor_set cantor_set::set_boolean(cantor_set& other_set) {
-    cantor_set result('{');
-    cantor_set empty('{');
-    result.set_elements.emplace_back(empty);
-    for (const auto& element : other_set.set_elements) {
-        size_t current_size = result.set_elements.size();
+    set_pool& pool = set_pool::instance();
+    vec_element subsets;
+    subsets.emplace_back(pool.intern(false, vec_element()));
+    for (const auto& element : other_set.root->elements) {
+        size_t current_size = subsets.size();
         for (size_t i = 0; i < current_size; ++i) {
-            cantor_set new_subset = std::get<1>(result.set_elements[i]);
-            new_subset.set_elements.push_back(element);
-            result.set_elements.emplace_back(new_subset);
+            vec_element new_subset = std::get<1>(subsets[i])->elements;
+            new_subset.push_back(element);
+            subsets.emplace_back(pool.intern(false, std::move(new_subset)));
         }
     }
-    return result;
+    return cantor_set(pool.intern(false, std::move(subsets)));
 }
 
 std::ostream& operator<<(std::ostream& output, const cantor_set &set_to_print) {
@@ -273,6 +296,6 @@ std::ostream& operator<<(std::ostream& output, const cantor_set &set_to_print) {
 std::istream& operator>>(std::istream& input, cantor_set &set_to_input) {
     std::string input_string;
     std::getline(input, input_string);
-    set_to_input=std::get<1>(set_to_input.element_initializer(input_string));
+    set_to_input=cantor_set(input_string);
     return input;
 }
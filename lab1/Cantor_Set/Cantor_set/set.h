@@ -9,8 +9,10 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <variant>
+#include "set_node.h"
 
 /**
  * @brief Класс для работы с канторовкими множествами
@@ -18,46 +20,51 @@
  * @details Класс реализует функционал для работы с канторовкими множествами,
  * включая ориентированные и неориентированные множества, операции над множествами
  * и вложенные структуры. Поддерживает элементы типа char и вложенные множества.
+ *
+ * Содержимое множества хранится в неизменяемом интернированном узле set_node,
+ * поэтому одинаковые вложенные множества хранятся один раз, копирование множества
+ * стоит O(1), а изменяющие операции строят новый узел через set_pool.
+ *
+ * Элементы неориентированного множества хранятся в каноническом порядке, поэтому
+ * объединение, пересечение и разность выполняются слиянием. Ориентированное множество
+ * сохраняет порядок добавления элементов. Проверка принадлежности, добавление и удаление
+ * в больших множествах используют хеш-индекс узла, а буквы 'a'-'z' неориентированного
+ * множества дополнительно хранятся в битовой маске, так что операции над ними
+ * выполняются битовыми инструкциями.
  */
 class cantor_set{
 private:
-    using element = std::variant<char, cantor_set>; ///< Тип элемента множества
-    using vec_element=std::vector<std::variant<char, cantor_set>>; ///< Тип контейнера для элементов
-    vec_element set_elements; ///< Вектор элементов множества
-    bool is_directed; ///< Флаг ориентированности множества
+    friend class power_set_generator;
+    friend class parallel_engine;
+    friend class set_reader;
 
-    /**
-     * @brief Инициализирует элементы множества из строки
-     * @param elements_string Строка с элементами множества
-     * @param start_brace Начальная скобка '{' или '<'
-     * @param position Позиция в строке для парсинга
-     * @return Инициализированное множество
-     */
-    cantor_set initialize_set_elems(const std::string&,const char& ,size_t&);
+    using element = set_element; ///< Тип элемента множества
+    using vec_element=std::vector<set_element>; ///< Тип контейнера для элементов
+    node_handle root; ///< Интернированный узел с элементами множества
 
     /**
-     * @brief Сравнивает два элемента множества
-     * @param first_elem Первый элемент для сравнения
-     * @param second_elem Второй элемент для сравнения
-     * @return true, если элементы равны, иначе false
+     * @brief Конструктор по готовому узлу
+     * @param node Интернированный узел
      */
-    bool compare_elems(const element&, const element &) const;
+    explicit cantor_set(node_handle);
 
     /**
-     * @brief Сравнивает два множества
-     * @param first_set Первое множество для сравнения
-     * @param second_set Второе множество для сравнения
-     * @return true, если множества равны, иначе false
+     * @brief Инициализирует элементы множества из строки
+     * @param elements_string Строка с элементами множества
+     * @param start_brace Начальная скобка '{' или '<'
+     * @param position Позиция в строке для парсинга
+     * @return Интернированный узел множества
+     * @details Незакрытые множества хранятся в set_builder, а не в стеке вызовов.
      */
-    bool compare_sets(const cantor_set &, const cantor_set &) const;
+    node_handle initialize_set_elems(const std::string&,const char& ,size_t&);
 
     /**
-     * @brief Находит элемент в множестве по строке
-     * @param cantor_set_ Множество для поиска
-     * @param input_string Строка с элементом для поиска
-     * @return Индекс элемента или -1, если не найден
+     * @brief Возвращает элементы узла в каноническом порядке
+     * @param node Узел множества
+     * @param storage Буфер для отсортированной копии элементов ориентированного множества
+     * @return Элементы неориентированного множества или отсортированная копия в storage
      */
-    int find_element(const cantor_set &, const std::string &);
+    static const vec_element& canonical_elements(const node_handle &, vec_element &);
 
     /**
      * @brief Находит элемент в текущем множестве по строке
@@ -70,17 +77,10 @@ private:
      * @brief Находит элемент в текущем множестве
      * @param elem_to_find Элемент для поиска
      * @return Индекс элемента или -1, если не найден
+     * @details В больших множествах элемент ищется по хеш-индексу узла.
      */
     int find_element(const element &);
 
-    /**
-     * @brief Находит элемент в указанном множестве
-     * @param cantor_set_ Множество для поиска
-     * @param elem_to_find Элемент для поиска
-     * @return Индекс элемента или -1, если не найден
-     */
-    int find_element(const cantor_set &, const element &);
-
     /**
      * @brief Добавляет элемент в множество
      * @param elem_to_add Элемент для добавления
@@ -127,6 +127,27 @@ public:
      */
     cantor_set& operator=(const cantor_set &);
 
+    /**
+     * @brief Разбирает запись неориентированного множества
+     * @param text Запись вида {...}, запятые и пробелы служат разделителями
+     * @return Множество
+     * @throw set_parse_error если запись неверна; ошибка содержит позицию символа
+     * @details Проверка и построение выполняются за один проход set_parser.
+     */
+    static cantor_set parse(std::string_view);
+
+    /**
+     * @brief Возвращает интернированный узел множества
+     * @return Узел, общий для всех равных по строению множеств
+     */
+    const node_handle& get_node() const;
+
+    /**
+     * @brief Возвращает структурный хеш множества
+     * @return Хеш, не зависящий от порядка элементов в {} и зависящий от него в <>
+     */
+    size_t get_hash() const;
+
     /**
      * @brief Инициализатор элемента из строки
      * @param input_string Строка для инициализации элемента
@@ -139,14 +160,14 @@ public:
      * @param string_to_add Строка с элементом для добавления
      * @return true, если элемент добавлен, false, если уже существует
      */
-    bool add_helper(std::string&);
+    bool add_helper(const std::string&);
 
     /**
      * @brief Вспомогательный метод для удаления элемента по строке
      * @param string_to_delete Строка с элементом для удаления
      * @return true, если элемент удален, false, если не найден
      */
-    bool delete_helper(std::string&);
+    bool delete_helper(const std::string&);
 
     /**
      * @brief Проверяет пустое ли множество
@@ -185,6 +206,7 @@ public:
      * @param elem_to_print Элемент для печати
      * @param printed_set Строка для накопления результата
      * @return Строковое представление элемента
+     * @details Вложенные множества обходятся с явным стеком, поэтому глубина ограничена только памятью.
      */
     std::string print_set(const element &, std::string&) const;
 
@@ -200,7 +222,7 @@ public:
      * @param input_string Строка с элементом для проверки
      * @return true, если элемент принадлежит множеству, иначе false
      */
-    bool operator[](std::string &);
+    bool operator[](const std::string &);
 
     /**
      * @brief Оператор объединения с присваиванием
@@ -269,4 +291,19 @@ std::ostream& operator<<(std::ostream&, const cantor_set &);
  */
 std::istream& operator>>(std::istream&, cantor_set &);
 
+/**
+ * @brief Специализация std::hash для cantor_set
+ */
+template<>
+struct std::hash<cantor_set> {
+    /**
+     * @brief Вычисляет хеш множества
+     * @param set_to_hash Множество
+     * @return Структурный хеш множества
+     */
+    size_t operator()(const cantor_set& set_to_hash) const noexcept {
+        return set_to_hash.get_hash();
+    }
+};
+
 #endif //SEM3_L1_PPOIS_P2_SET_H
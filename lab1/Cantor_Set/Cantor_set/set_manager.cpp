@@ -1,11 +1,12 @@
 #include "set_manager.h"
 #include <iostream>
+#include <stdexcept>
 #include <vector>
-#include "string_validator.h"
+#include "set_serializer.h"
 
-bool set_manager::create_set(const std::string& elements) {
-    if(find_set(elements)!=-1) return false;
-    set_list.emplace_back(elements);
+bool set_manager::create_set(const cantor_set& new_set) {
+    if(find_set(new_set)!=-1) return false;
+    set_list.push_back(new_set);
     return true;
 }
 
@@ -15,8 +16,7 @@ bool set_manager::delete_set(size_t set_index) {
     return true;
 }
 
-size_t set_manager::find_set(const std::string& elements){
-    cantor_set cantor_set_(elements);
+size_t set_manager::find_set(const cantor_set& cantor_set_){
     for (size_t i = 0; i < set_manager::set_list.size(); ++i){
         if (set_manager::set_list[i]==cantor_set_) return i;
     }
@@ -24,10 +24,7 @@ size_t set_manager::find_set(const std::string& elements){
 }
 
 bool set_manager::create_set_help(const std::string& elements){
-    std::string new_elements=elements;
-    if(!string_validator::set_read(new_elements,false))
-        throw std::invalid_argument("Множество введено неверно");
-    return create_set(new_elements);
+    return create_set(cantor_set::parse(elements));
 }
 
 bool set_manager::delete_set_help(size_t set_number){
@@ -70,3 +67,35 @@ cantor_set set_manager::set_boolean(size_t set_index) {
     cantor_set result = set_list[set_index].set_boolean(set_list[set_index]);
     return result;
 }
+
+power_set_generator set_manager::boolean_generator(size_t set_index) const {
+    return power_set_generator(set_list[set_index]);
+}
+
+uint64_t set_manager::boolean_cardinality(size_t set_index) const {
+    return power_set_generator(set_list[set_index]).cardinality();
+}
+
+void set_manager::print_boolean(size_t set_index, std::ostream& output) const {
+    power_set_generator(set_list[set_index]).write_to(output);
+}
+
+void set_manager::save(std::ostream& output) const {
+    set_writer writer(output);
+    for (const cantor_set &set : set_list) writer.write(set);
+    writer.finish();
+}
+
+size_t set_manager::load(std::istream& input) {
+    set_reader reader(input);
+    cantor_set loaded_set('{');
+    std::vector<cantor_set> loaded_sets;
+    while (reader.read(loaded_set)) {
+        if (loaded_set.is_directed_set())
+            throw std::runtime_error("Ориентированное множество не может храниться в списке");
+        loaded_sets.push_back(loaded_set);
+    }
+    size_t loaded = 0;
+    for (const cantor_set &set : loaded_sets) loaded += create_set(set);
+    return loaded;
+}
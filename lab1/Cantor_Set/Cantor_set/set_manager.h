@@ -8,6 +8,8 @@
 #define SEM3_L1_PPOIS_P2_SET_MANAGER_H
 
 #include "set.h"
+#include "power_set.h"
+#include <iostream>
 #include <vector>
 
 /**
@@ -22,11 +24,11 @@ private:
     std::vector<cantor_set> set_list; ///< Вектор для хранения множеств
 
     /**
-     * @brief Создает новое множество из строки
-     * @param elements Строка с элементами множества
+     * @brief Добавляет множество в список
+     * @param new_set Разобранное множество
      * @return true, если множество создано, false, если такое множество уже существует
      */
-    bool create_set(const std::string&);
+    bool create_set(const cantor_set&);
 
     /**
      * @brief Удаляет множество по индексу
@@ -36,20 +38,21 @@ private:
     bool delete_set(size_t);
 
     /**
-     * @brief Находит множество по его строковому представлению
-     * @param elements Строковое представление множества
+     * @brief Находит множество в списке
+     * @param set_to_find Множество для поиска
      * @return Индекс множества или -1, если не найдено
      */
-    size_t find_set(const std::string&);
+    size_t find_set(const cantor_set&);
 
 public:
     /**
      * @brief Публичный метод для создания множества
      * @param elements Строка с элементами множества
      * @return true, если множество создано, false, если такое множество уже существует
+     * @throw set_parse_error если запись множества неверна
      * @see create_set()
      */
-    bool create_set_help(std::string&);
+    bool create_set_help(const std::string&);
 
     /**
      * @brief Публичный метод для удаления множества
@@ -108,6 +111,50 @@ public:
      * @return Булеан указанного множества
      */
     cantor_set set_boolean(size_t set_index);
+
+    /**
+     * @brief Создает генератор подмножеств множества без построения булеана
+     * @param set_index Индекс множества
+     * @return Генератор, выдающий подмножества по одному в порядке кода Грея
+     */
+    power_set_generator boolean_generator(size_t set_index) const;
+
+    /**
+     * @brief Возвращает мощность булеана множества
+     * @param set_index Индекс множества
+     * @return Количество подмножеств
+     * @throw std::overflow_error если множество содержит 64 и более элементов
+     */
+    uint64_t boolean_cardinality(size_t set_index) const;
+
+    /**
+     * @brief Выводит булеан множества в поток по мере построения подмножеств
+     * @param set_index Индекс множества
+     * @param output Поток вывода
+     * @details Память не зависит от размера булеана.
+     * @throw std::overflow_error если множество содержит 64 и более элементов
+     */
+    void print_boolean(size_t set_index, std::ostream& output) const;
+
+    /**
+     * @brief Сохраняет все множества в двоичном формате
+     * @param output Поток вывода, открытый в двоичном режиме
+     * @throw std::runtime_error если запись не удалась
+     * @details Общие вложенные множества записываются один раз для всего потока.
+     * @see set_writer
+     */
+    void save(std::ostream& output) const;
+
+    /**
+     * @brief Добавляет множества, сохраненные методом save
+     * @param input Поток ввода, открытый в двоичном режиме
+     * @return Количество добавленных множеств; уже существующие множества пропускаются
+     * @throw std::runtime_error если данные повреждены или содержат ориентированное множество
+     * @details Множества читаются по одному, без текстового разбора и проверки записи.
+     * Список меняется только после того, как весь поток прочитан без ошибок.
+     * @see set_reader
+     */
+    size_t load(std::istream& input);
 };
 
 #endif //SEM3_L1_PPOIS_P2_SET_MANAGER_H
@@ -0,0 +1,274 @@
+#include "set_node.h"
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace {
+    size_t mix_hash(uint64_t value) {
+        value += 0x9e3779b97f4a7c15ULL;
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+        return static_cast<size_t>(value ^ (value >> 31));
+    }
+
+    size_t structural_hash_of(bool is_directed, const set_element* elements, size_t size) {
+        if (is_directed) {
+            size_t hash = 0x3c6ef372fe94f82bULL;
+            for (size_t i = 0; i < size; ++i) hash = mix_hash(hash * 31 + set_pool::element_hash(elements[i]));
+            return hash;
+        }
+        size_t element_sum = 0;
+        for (size_t i = 0; i < size; ++i) element_sum += mix_hash(set_pool::element_hash(elements[i]));
+        return mix_hash(0xa54ff53a5f1d36f1ULL ^ element_sum);
+    }
+}
+
+void element_index::place(size_t hash, uint32_t position) {
+    size_t mask = slots.size() - 1;
+    size_t slot = hash & mask;
+    while (slots[slot] != empty_slot) slot = (slot + 1) & mask;
+    slots[slot] = position;
+}
+
+void element_index::assign(const set_element* elements, size_t size) {
+    size_t slot_number = 16;
+    while (slot_number < size * 2) slot_number *= 2;
+    slots.assign(slot_number, empty_slot);
+    element_number = size;
+    for (size_t i = 0; i < size; ++i) place(set_pool::element_hash(elements[i]), static_cast<uint32_t>(i));
+}
+
+void element_index::add_last(const set_element* elements, size_t size) {
+    if ((element_number + 1) * 2 > slots.size()) {
+        assign(elements, size);
+        return;
+    }
+    element_number++;
+    place(set_pool::element_hash(elements[size - 1]), static_cast<uint32_t>(size - 1));
+}
+
+int element_index::find(const set_element* elements, const set_element& elem_to_find) const {
+    if (slots.empty()) return -1;
+    size_t mask = slots.size() - 1;
+    for (size_t slot = set_pool::element_hash(elem_to_find) & mask; slots[slot] != empty_slot; slot = (slot + 1) & mask) {
+        if (elements[slots[slot]] == elem_to_find) return static_cast<int>(slots[slot]);
+    }
+    return -1;
+}
+
+int set_node::find(const set_element& elem_to_find) const {
+    if (elem_to_find.index() == 0 && has_mask_atoms()) {
+        char atom = std::get<0>(elem_to_find);
+        if (atom >= 'a' && atom <= 'z') {
+            uint32_t atom_bit = 1u << (atom - 'a');
+            if (!(atom_mask & atom_bit)) return -1;
+            return static_cast<int>(std::bitset<32>(atom_mask & (atom_bit - 1)).count());
+        }
+    }
+    if (index) return index->find(elements.data(), elem_to_find);
+    for (size_t i = 0; i < elements.size(); ++i) {
+        if (elements[i] == elem_to_find) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+bool set_node::has_mask_atoms() const {
+    return !is_directed && std::bitset<32>(atom_mask).count() == atom_number;
+}
+
+set_pool::pool_shard::pool_shard(std::pmr::memory_resource* memory) : interned_nodes(memory) {}
+
+set_pool::set_pool() {
+    for (size_t i = 0; i < shard_number; ++i) shards.emplace_back(&node_memory);
+}
+
+set_pool& set_pool::instance() {
+    static set_pool* pool = new set_pool();
+    return *pool;
+}
+
+bool set_pool::same_structure(const set_node& node, bool is_directed, const set_element* elements, size_t size) {
+    if (node.is_directed != is_directed || node.elements.size() != size) return false;
+    for (size_t i = 0; i < size; ++i) {
+        if (node.elements[i] != elements[i]) return false;
+    }
+    return true;
+}
+
+set_pool::pool_shard& set_pool::shard_for(size_t hash) {
+    return shards[(hash >> 16) % shard_number];
+}
+
+node_handle set_pool::find_interned(pool_shard& shard, size_t hash, bool is_directed,
+                                    const set_element* elements, size_t size) {
+    auto range = shard.interned_nodes.equal_range(hash);
+    for (auto current = range.first; current != range.second; ++current) {
+        if (same_structure(*current->second.node, is_directed, elements, size)) {
+            if (node_handle existing = current->second.handle.lock()) return existing;
+        }
+    }
+    return nullptr;
+}
+
+node_handle set_pool::intern(bool is_directed, std::vector<set_element> elements) {
+    if (!is_directed && !std::is_sorted(elements.begin(), elements.end(), element_less))
+        std::sort(elements.begin(), elements.end(), element_less);
+    return intern_elements(is_directed, elements.data(), elements.size(), &elements);
+}
+
+node_handle set_pool::intern_sorted(bool is_directed, const std::pmr::vector<set_element>& elements) {
+    return intern_elements(is_directed, elements.data(), elements.size(), nullptr);
+}
+
+node_handle set_pool::intern_elements(bool is_directed, const set_element* elements, size_t size,
+                                      std::vector<set_element>* owned_elements) {
+    size_t hash = structural_hash_of(is_directed, elements, size);
+    pool_shard& shard = shard_for(hash);
+    {
+        std::lock_guard<std::mutex> lock(shard.shard_mutex);
+        if (node_handle existing = find_interned(shard, hash, is_directed, elements, size)) return existing;
+    }
+
+    std::vector<set_element> node_elements = owned_elements ? std::move(*owned_elements)
+                                                            : std::vector<set_element>(elements, elements + size);
+    std::unique_ptr<element_index> index;
+    if (size >= set_node::index_threshold) {
+        index = std::make_unique<element_index>();
+        index->assign(node_elements.data(), size);
+    }
+    uint32_t atom_mask = 0;
+    uint32_t atom_number = 0;
+    if (!is_directed) {
+        for (; atom_number < size && node_elements[atom_number].index() == 0; ++atom_number) {
+            char atom = std::get<0>(node_elements[atom_number]);
+            if (atom >= 'a' && atom <= 'z') atom_mask |= 1u << (atom - 'a');
+        }
+    }
+    std::pmr::polymorphic_allocator<set_node> allocator(&node_memory);
+    set_node* node = allocator.allocate(1);
+    new (node) set_node{is_directed, std::move(node_elements), hash, atom_mask, atom_number, std::move(index)};
+    node_handle created(node, [this](const set_node* released) { release(released); }, allocator);
+    node_handle existing;
+    {
+        std::lock_guard<std::mutex> lock(shard.shard_mutex);
+        existing = find_interned(shard, hash, is_directed, node->elements.data(), size);
+        if (!existing) {
+            shard.interned_nodes.emplace(hash, pool_entry{node, created});
+            return created;
+        }
+    }
+    return existing;
+}
+
+void set_pool::destroy(const set_node* node) {
+    node->~set_node();
+    std::pmr::polymorphic_allocator<set_node>(&node_memory).deallocate(const_cast<set_node*>(node), 1);
+}
+
+void set_pool::release(const set_node* node) {
+    {
+        pool_shard& shard = shard_for(node->structural_hash);
+        std::lock_guard<std::mutex> lock(shard.shard_mutex);
+        auto range = shard.interned_nodes.equal_range(node->structural_hash);
+        for (auto current = range.first; current != range.second; ++current) {
+            if (current->second.node == node) {
+                shard.interned_nodes.erase(current);
+                break;
+            }
+        }
+    }
+    thread_local std::vector<const set_node*> pending_nodes;
+    thread_local bool releasing = false;
+    pending_nodes.push_back(node);
+    if (releasing) return;
+    releasing = true;
+    while (!pending_nodes.empty()) {
+        const set_node* released = pending_nodes.back();
+        pending_nodes.pop_back();
+        destroy(released);
+    }
+    releasing = false;
+}
+
+size_t set_pool::node_count() {
+    size_t count = 0;
+    for (pool_shard& shard : shards) {
+        std::lock_guard<std::mutex> lock(shard.shard_mutex);
+        count += shard.interned_nodes.size();
+    }
+    return count;
+}
+
+bool set_pool::add_unique(std::pmr::vector<set_element>& elements, element_index& index, set_element elem_to_add) {
+    if (elements.size() < set_node::index_threshold) {
+        if (std::find(elements.begin(), elements.end(), elem_to_add) != elements.end()) return false;
+        elements.push_back(std::move(elem_to_add));
+        if (elements.size() == set_node::index_threshold) index.assign(elements.data(), elements.size());
+        return true;
+    }
+    if (index.find(elements.data(), elem_to_add) != -1) return false;
+    elements.push_back(std::move(elem_to_add));
+    index.add_last(elements.data(), elements.size());
+    return true;
+}
+
+size_t set_pool::element_hash(const set_element& elem) {
+    if (elem.index() == 0) return mix_hash(static_cast<unsigned char>(std::get<0>(elem)));
+    return std::get<1>(elem)->structural_hash;
+}
+
+int set_pool::compare_elements(const set_element& first_elem, const set_element& second_elem) {
+    struct compared_pair {
+        const set_node* first_node;
+        const set_node* second_node;
+        size_t position;
+    };
+    thread_local std::vector<compared_pair> unfinished;
+    unfinished.clear();
+    const set_element* first_current = &first_elem;
+    const set_element* second_current = &second_elem;
+    while (true) {
+        if (first_current) {
+            if (first_current->index() != second_current->index()) return first_current->index() == 0 ? -1 : 1;
+            if (first_current->index() == 0) {
+                int result = static_cast<int>(static_cast<unsigned char>(std::get<0>(*first_current))) -
+                             static_cast<int>(static_cast<unsigned char>(std::get<0>(*second_current)));
+                if (result != 0) return result;
+            } else {
+                const set_node* first_node = std::get<1>(*first_current).get();
+                const set_node* second_node = std::get<1>(*second_current).get();
+                if (first_node != second_node) {
+                    if (first_node->is_directed != second_node->is_directed) return first_node->is_directed ? 1 : -1;
+                    unfinished.push_back({first_node, second_node, 0});
+                }
+            }
+        }
+        if (unfinished.empty()) return 0;
+        compared_pair& top = unfinished.back();
+        size_t common_size = std::min(top.first_node->elements.size(), top.second_node->elements.size());
+        if (top.position < common_size) {
+            first_current = &top.first_node->elements[top.position];
+            second_current = &top.second_node->elements[top.position];
+            top.position++;
+            continue;
+        }
+        if (top.first_node->elements.size() != top.second_node->elements.size())
+            return top.first_node->elements.size() < top.second_node->elements.size() ? -1 : 1;
+        unfinished.pop_back();
+        first_current = nullptr;
+    }
+}
+
+bool set_pool::element_less(const set_element& first_elem, const set_element& second_elem) {
+    return compare_elements(first_elem, second_elem) < 0;
+}
+
+bool set_pool::elements_equal(const set_element& first_elem, const set_element& second_elem) {
+    return first_elem == second_elem;
+}
+
+bool set_pool::nodes_equal(const node_handle& first_node, const node_handle& second_node) {
+    return first_node == second_node;
+}
@@ -0,0 +1,303 @@
+/**
+ * @file set_node.h
+ * @brief Заголовочный файл неизменяемых узлов множеств и таблицы их интернирования
+ * @author Ященко Александра
+ */
+
+#ifndef SEM3_L1_PPOIS_P2_SET_NODE_H
+#define SEM3_L1_PPOIS_P2_SET_NODE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+struct set_node;
+
+using node_handle = std::shared_ptr<const set_node>; ///< Ссылка на интернированный узел
+using set_element = std::variant<char, node_handle>; ///< Элемент множества: буква или вложенное множество
+
+/**
+ * @brief Хеш-индекс позиций элементов множества
+ *
+ * @details Таблица с открытой адресацией и линейным пробированием хранит позиции
+ * элементов в векторе; сами элементы индекс не хранит и при поиске сравнивает
+ * их с вектором. Заполненность таблицы не превышает половины.
+ */
+class element_index {
+private:
+    static constexpr uint32_t empty_slot = UINT32_MAX; ///< Метка свободной ячейки
+
+    std::vector<uint32_t> slots; ///< Позиции элементов или empty_slot
+    size_t element_number = 0; ///< Количество занесенных позиций
+
+    /**
+     * @brief Заносит позицию в таблицу без проверки заполненности
+     * @param hash Хеш элемента
+     * @param position Позиция элемента
+     */
+    void place(size_t hash, uint32_t position);
+
+public:
+    /**
+     * @brief Перестраивает индекс по всем элементам массива
+     * @param elements Элементы без повторов
+     * @param size Количество элементов
+     */
+    void assign(const set_element* elements, size_t size);
+
+    /**
+     * @brief Заносит в индекс последний элемент массива
+     * @param elements Элементы, последний из которых только что добавлен
+     * @param size Количество элементов вместе с добавленным
+     */
+    void add_last(const set_element* elements, size_t size);
+
+    /**
+     * @brief Находит элемент
+     * @param elements Элементы, по которым построен индекс
+     * @param elem_to_find Элемент для поиска
+     * @return Индекс элемента или -1, если не найден
+     */
+    int find(const set_element* elements, const set_element& elem_to_find) const;
+};
+
+/**
+ * @brief Неизменяемый узел множества
+ *
+ * @details Узлы создаются только через set_pool::intern, поэтому одинаковые по строению
+ * множества хранятся в одном экземпляре, а вложенные множества ссылаются на него.
+ * У множеств от index_threshold элементов строится хеш-индекс, и поиск элемента
+ * выполняется за O(1) в среднем; в меньших множествах элементы перебираются.
+ *
+ * В каноническом порядке буквы стоят перед вложенными множествами, поэтому у
+ * неориентированного множества буквы занимают первые atom_number элементов и
+ * дублируются в битовой маске atom_mask. Если все буквы лежат в диапазоне 'a'-'z',
+ * маска описывает буквенную часть полностью и проверка буквы сводится к проверке бита.
+ */
+struct set_node {
+    static constexpr size_t index_threshold = 16; ///< Размер множества, с которого строится индекс
+
+    bool is_directed; ///< Флаг ориентированности множества
+    std::vector<set_element> elements; ///< Элементы множества
+    size_t structural_hash; ///< Хеш содержимого, не зависящий от порядка элементов неориентированного множества
+    uint32_t atom_mask; ///< Биты букв 'a'-'z' среди элементов неориентированного множества, бит 0 - 'a'
+    uint32_t atom_number; ///< Количество букв в начале элементов неориентированного множества
+    std::unique_ptr<const element_index> index; ///< Индекс элементов или nullptr для малых множеств
+
+    /**
+     * @brief Находит элемент в множестве
+     * @param elem_to_find Элемент для поиска
+     * @return Индекс элемента или -1, если не найден
+     */
+    int find(const set_element& elem_to_find) const;
+
+    /**
+     * @brief Проверяет, описывает ли atom_mask все буквы множества
+     * @return true для неориентированного множества, все буквы которого лежат в диапазоне 'a'-'z'
+     */
+    bool has_mask_atoms() const;
+};
+
+/**
+ * @brief Таблица интернирования узлов множеств (hash-consing)
+ *
+ * @details Таблица хранит слабые ссылки на все живые узлы, сгруппированные по хешу.
+ * Перед созданием узла intern ищет узел с тем же флагом ориентированности и той же
+ * последовательностью элементов (вложенные множества сравниваются по адресу) и
+ * возвращает его, если он есть. Узел удаляется из таблицы, когда исчезает последняя
+ * ссылка на него. Таблица разделена на shard_number частей по хешу узла, у каждой
+ * части свой мьютекс, поэтому потоки, создающие разные узлы, почти не ждут друг друга.
+ * Индекс и маска нового узла строятся без захвата мьютекса.
+ *
+ * Элементы неориентированного множества хранятся в каноническом порядке compare_elements,
+ * поэтому равные множества всегда представлены одним узлом.
+ *
+ * Узлы вместе со счетчиками ссылок shared_ptr и записи таблицы размещаются в общем
+ * пуле памяти node_memory, поэтому создание и удаление узла не обращаются к malloc
+ * за каждым из этих объектов по отдельности. Освобожденные блоки пула используются
+ * для новых узлов.
+ */
+class set_pool {
+private:
+    /**
+     * @brief Запись таблицы
+     */
+    struct pool_entry {
+        const set_node* node; ///< Адрес узла, по нему запись удаляется
+        std::weak_ptr<const set_node> handle; ///< Слабая ссылка на узел
+    };
+
+    /**
+     * @brief Часть таблицы со своим мьютексом
+     */
+    struct pool_shard {
+        std::mutex shard_mutex; ///< Мьютекс части
+        std::pmr::unordered_multimap<size_t, pool_entry> interned_nodes; ///< Живые узлы части по хешу
+
+        /**
+         * @brief Конструктор
+         * @param memory Пул памяти для записей
+         */
+        explicit pool_shard(std::pmr::memory_resource* memory);
+    };
+
+    static constexpr size_t shard_number = 16; ///< Количество частей таблицы
+
+    std::pmr::synchronized_pool_resource node_memory; ///< Пул памяти узлов, счетчиков ссылок и записей таблицы
+    std::deque<pool_shard> shards; ///< Части таблицы, узел попадает в часть по хешу
+
+    set_pool();
+
+    /**
+     * @brief Возвращает часть таблицы для хеша
+     * @param hash Структурный хеш узла
+     * @return Часть таблицы
+     */
+    pool_shard& shard_for(size_t hash);
+
+    /**
+     * @brief Ищет живой узел с заданным строением
+     * @param shard Часть таблицы, мьютекс которой захвачен
+     * @param hash Структурный хеш
+     * @param is_directed Флаг ориентированности
+     * @param elements Элементы
+     * @param size Количество элементов
+     * @return Узел или nullptr
+     */
+    static node_handle find_interned(pool_shard& shard, size_t hash, bool is_directed,
+                                     const set_element* elements, size_t size);
+
+    /**
+     * @brief Создает узел или возвращает существующий
+     * @param is_directed Флаг ориентированности
+     * @param elements Элементы в каноническом порядке для неориентированного множества
+     * @param size Количество элементов
+     * @param owned_elements Вектор с теми же элементами, который можно забрать в узел, или nullptr
+     * @return Ссылка на единственный узел с таким строением
+     * @details Если owned_elements равен nullptr, элементы копируются только при создании нового узла.
+     */
+    node_handle intern_elements(bool is_directed, const set_element* elements, size_t size,
+                                std::vector<set_element>* owned_elements);
+
+    /**
+     * @brief Разрушает узел и возвращает его память в пул
+     * @param node Узел, уже удаленный из таблицы
+     */
+    void destroy(const set_node* node);
+
+    /**
+     * @brief Удаляет узел из таблицы и освобождает его
+     * @param node Узел, на который не осталось ссылок
+     * @details Узлы, освободившиеся при удалении другого узла, откладываются в список
+     * потока и удаляются в цикле, поэтому удаление глубоко вложенного множества
+     * не расходует стек вызовов.
+     */
+    void release(const set_node* node);
+
+    /**
+     * @brief Проверяет совпадение строения узла с заданным
+     * @param node Узел из таблицы
+     * @param is_directed Флаг ориентированности
+     * @param elements Элементы
+     * @param size Количество элементов
+     * @return true, если флаг и элементы совпадают по порядку, а вложенные узлы - по адресу
+     */
+    static bool same_structure(const set_node& node, bool is_directed, const set_element* elements, size_t size);
+
+public:
+    set_pool(const set_pool&) = delete;
+    set_pool& operator=(const set_pool&) = delete;
+
+    /**
+     * @brief Возвращает общую таблицу
+     * @return Ссылка на таблицу, существующую до конца работы программы
+     */
+    static set_pool& instance();
+
+    /**
+     * @brief Возвращает узел с заданным содержимым, создавая его при необходимости
+     * @param is_directed Флаг ориентированности
+     * @param elements Элементы множества без повторов
+     * @return Ссылка на единственный узел с таким строением
+     * @details Элементы неориентированного множества сортируются, если они еще не упорядочены.
+     */
+    node_handle intern(bool is_directed, std::vector<set_element> elements);
+
+    /**
+     * @brief Возвращает узел с заданным содержимым без передачи владения элементами
+     * @param is_directed Флаг ориентированности
+     * @param elements Элементы без повторов, у неориентированного множества - в каноническом порядке
+     * @return Ссылка на единственный узел с таким строением
+     * @details Элементы копируются в новый вектор, только если такого узла еще нет, поэтому
+     * временные элементы можно держать в арене разбора.
+     */
+    node_handle intern_sorted(bool is_directed, const std::pmr::vector<set_element>& elements);
+
+    /**
+     * @brief Возвращает количество живых узлов
+     * @return Количество узлов в таблице
+     */
+    size_t node_count();
+
+    /**
+     * @brief Добавляет элемент в вектор, если его там еще нет
+     * @param elements Элементы без повторов
+     * @param index Индекс элементов вектора, строится с set_node::index_threshold элементов
+     * @param elem_to_add Элемент для добавления
+     * @return true, если элемент добавлен
+     * @details Пока элементов меньше set_node::index_threshold, повтор ищется перебором.
+     */
+    static bool add_unique(std::pmr::vector<set_element>& elements, element_index& index, set_element elem_to_add);
+
+    /**
+     * @brief Вычисляет хеш элемента
+     * @param elem Элемент
+     * @return Хеш буквы или кэшированный хеш узла
+     */
+    static size_t element_hash(const set_element& elem);
+
+    /**
+     * @brief Сравнивает элементы в каноническом порядке
+     * @param first_elem Первый элемент
+     * @param second_elem Второй элемент
+     * @return Отрицательное число, ноль или положительное число
+     * @details Буквы идут раньше множеств и упорядочены по коду, неориентированные множества
+     * идут раньше ориентированных, множества одного вида сравниваются лексикографически
+     * по своим элементам. Ноль возвращается только для равных элементов. Вложенные
+     * множества обходятся с явным стеком, а не рекурсией.
+     */
+    static int compare_elements(const set_element& first_elem, const set_element& second_elem);
+
+    /**
+     * @brief Проверяет, идет ли первый элемент раньше второго в каноническом порядке
+     * @param first_elem Первый элемент
+     * @param second_elem Второй элемент
+     * @return true, если compare_elements меньше нуля
+     */
+    static bool element_less(const set_element& first_elem, const set_element& second_elem);
+
+    /**
+     * @brief Сравнивает элементы как множества
+     * @param first_elem Первый элемент
+     * @param second_elem Второй элемент
+     * @return true, если элементы равны
+     */
+    static bool elements_equal(const set_element& first_elem, const set_element& second_elem);
+
+    /**
+     * @brief Сравнивает узлы как множества
+     * @param first_node Первый узел
+     * @param second_node Второй узел
+     * @return true, если множества равны
+     * @details Равные множества представлены одним узлом, поэтому сравниваются адреса.
+     */
+    static bool nodes_equal(const node_handle& first_node, const node_handle& second_node);
+};
+
+#endif //SEM3_L1_PPOIS_P2_SET_NODE_H
@@ -0,0 +1,166 @@
+#include "set_parser.h"
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+namespace {
+    /**
+     * Классы символов записи. Для каждого класса в forbidden_next хранится набор
+     * классов, которые не могут идти сразу за ним, - те же правила, что в
+     * string_validator::check_sequence_rules. Буква 'a' выделена в отдельный класс,
+     * потому что после закрывающих скобок запрещена только она.
+     */
+    enum character_class : uint8_t {
+        invalid_class, space_class, open_curly_class, close_curly_class, open_angle_class,
+        close_angle_class, comma_class, letter_a_class, letter_class, end_class
+    };
+
+    constexpr uint16_t class_bit(character_class current) {
+        return static_cast<uint16_t>(1u << current);
+    }
+
+    constexpr std::array<uint16_t, end_class + 1> forbidden_next = [] {
+        std::array<uint16_t, end_class + 1> table{};
+        table[open_curly_class] = class_bit(comma_class) | class_bit(close_angle_class);
+        table[close_curly_class] = class_bit(letter_a_class) | class_bit(open_angle_class) | class_bit(open_curly_class);
+        table[open_angle_class] = class_bit(comma_class) | class_bit(close_curly_class);
+        table[close_angle_class] = class_bit(letter_a_class) | class_bit(open_angle_class) | class_bit(open_curly_class);
+        table[comma_class] = class_bit(comma_class) | class_bit(close_curly_class) | class_bit(close_angle_class);
+        table[letter_a_class] = class_bit(letter_a_class) | class_bit(letter_class);
+        table[letter_class] = class_bit(letter_a_class) | class_bit(letter_class);
+        return table;
+    }();
+
+    constexpr std::array<character_class, 256> character_classes = [] {
+        std::array<character_class, 256> table{};
+        table[static_cast<unsigned char>(' ')] = space_class;
+        table[static_cast<unsigned char>('{')] = open_curly_class;
+        table[static_cast<unsigned char>('}')] = close_curly_class;
+        table[static_cast<unsigned char>('<')] = open_angle_class;
+        table[static_cast<unsigned char>('>')] = close_angle_class;
+        table[static_cast<unsigned char>(',')] = comma_class;
+        table[static_cast<unsigned char>('a')] = letter_a_class;
+        for (char letter = 'b'; letter <= 'z'; ++letter) table[static_cast<unsigned char>(letter)] = letter_class;
+        return table;
+    }();
+
+    character_class class_of(char character) {
+        return character_classes[static_cast<unsigned char>(character)];
+    }
+}
+
+set_parse_error::set_parse_error(const std::string& message, size_t position)
+        : std::invalid_argument("Ошибка в позиции " + std::to_string(position + 1) + ": " + message),
+          error_position(position) {}
+
+size_t set_parse_error::position() const {
+    return error_position;
+}
+
+set_parser::set_parser(std::string_view text) : text(text) {}
+
+void set_parser::fail(size_t at, const std::string& message) const {
+    throw set_parse_error(message, at);
+}
+
+void set_parser::check_character(size_t at) const {
+    character_class current = class_of(text[at]);
+    if (current == invalid_class) fail(at, std::string("недопустимый символ '") + text[at] + "'");
+    character_class next = at + 1 < text.size() ? class_of(text[at + 1]) : end_class;
+    if (forbidden_next[current] & class_bit(next))
+        fail(at + 1, std::string("символ '") + text[at + 1] + "' не может следовать за '" + text[at] + "'");
+}
+
+void set_builder::add(set_element elem_to_add) {
+    level& current = levels.back();
+    if (current.is_directed) set_pool::add_unique(current.elements, current.index, std::move(elem_to_add));
+    else current.elements.push_back(std::move(elem_to_add));
+}
+
+void set_builder::open(bool is_directed) {
+    levels.push_back(level{is_directed, std::pmr::vector<set_element>(&arena), {}});
+}
+
+void set_builder::add_atom(char atom) {
+    add(atom);
+}
+
+node_handle set_builder::close() {
+    level& current = levels.back();
+    if (!current.is_directed) {
+        std::sort(current.elements.begin(), current.elements.end(), set_pool::element_less);
+        current.elements.erase(std::unique(current.elements.begin(), current.elements.end()), current.elements.end());
+    }
+    node_handle node = set_pool::instance().intern_sorted(current.is_directed, current.elements);
+    levels.pop_back();
+    if (!levels.empty()) add(node);
+    return node;
+}
+
+size_t set_builder::depth() const {
+    return levels.size();
+}
+
+bool set_builder::is_directed() const {
+    return levels.back().is_directed;
+}
+
+node_handle set_parser::parse_nested() {
+    set_builder builder;
+    std::vector<size_t> open_positions;
+    while (true) {
+        if (position >= text.size()) {
+            char end_brace = builder.is_directed() ? '>' : '}';
+            fail(position, std::string("нет скобки '") + end_brace + "' для скобки в позиции " +
+                           std::to_string(open_positions.back() + 1));
+        }
+        check_character(position);
+        char current = text[position];
+        switch (current) {
+            case ' ':
+            case ',':
+                break;
+            case '{':
+            case '<':
+                builder.open(current == '<');
+                open_positions.push_back(position);
+                break;
+            case '}':
+            case '>':
+                if ((current == '>') != builder.is_directed())
+                    fail(position, std::string("скобка '") + current + "' не соответствует скобке в позиции " +
+                                   std::to_string(open_positions.back() + 1));
+                open_positions.pop_back();
+                if (builder.depth() == 1) {
+                    ++position;
+                    return builder.close();
+                }
+                builder.close();
+                break;
+            default:
+                builder.add_atom(current);
+                break;
+        }
+        ++position;
+    }
+}
+
+node_handle set_parser::parse_whole(bool allow_directed) {
+    if (text.empty()) fail(0, "пустая строка");
+    if (text[0] != '{' && (text[0] != '<' || !allow_directed))
+        fail(0, allow_directed ? "ожидалась скобка '{' или '<'" : "ожидалась скобка '{'");
+    node_handle node = parse_nested();
+    while (position < text.size() && text[position] == ' ') ++position;
+    if (position < text.size()) fail(position, "лишние символы после множества");
+    return node;
+}
+
+node_handle set_parser::parse_set(std::string_view text) {
+    return set_parser(text).parse_whole(false);
+}
+
+set_element set_parser::parse_element(std::string_view text) {
+    if (text.size() == 1 && text[0] >= 'a' && text[0] <= 'z') return text[0];
+    return set_parser(text).parse_whole(true);
+}
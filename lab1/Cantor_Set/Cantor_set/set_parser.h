@@ -0,0 +1,179 @@
+/**
+ * @file set_parser.h
+ * @brief Заголовочный файл однопроходного разборщика записи канторовских множеств
+ * @author Ященко Александра
+ */
+
+#ifndef SEM3_L1_PPOIS_P2_SET_PARSER_H
+#define SEM3_L1_PPOIS_P2_SET_PARSER_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "set_node.h"
+
+/**
+ * @brief Ошибка разбора записи множества
+ * @details Хранит позицию символа, на котором обнаружена ошибка.
+ */
+class set_parse_error : public std::invalid_argument {
+private:
+    size_t error_position; ///< Позиция ошибочного символа, считая с нуля
+
+public:
+    /**
+     * @brief Конструктор
+     * @param message Описание ошибки
+     * @param position Позиция ошибочного символа, считая с нуля
+     */
+    set_parse_error(const std::string& message, size_t position);
+
+    /**
+     * @brief Возвращает позицию ошибки
+     * @return Позиция ошибочного символа, считая с нуля; для неожиданного конца строки - ее длина
+     */
+    size_t position() const;
+};
+
+/**
+ * @brief Построитель вложенных множеств на явном стеке
+ *
+ * @details Хранит незакрытые множества в векторе уровней, поэтому глубина вложенности
+ * ограничена только памятью, а не стеком вызовов. Закрытое множество интернируется
+ * и становится элементом родительского уровня.
+ *
+ * Уровни и их временные элементы размещаются в монотонной арене построителя: память
+ * закрытых уровней не освобождается по отдельности, а вся арена освобождается разом
+ * вместе с построителем. Элементы копируются из арены в узел, только если такого узла
+ * в set_pool еще нет.
+ */
+class set_builder {
+private:
+    /**
+     * @brief Незакрытое множество
+     */
+    struct level {
+        bool is_directed; ///< Флаг ориентированности
+        std::pmr::vector<set_element> elements; ///< Собранные элементы в арене
+        element_index index; ///< Индекс элементов большого ориентированного множества для отсева повторов
+    };
+
+    std::pmr::monotonic_buffer_resource arena; ///< Арена временных данных разбора
+    std::pmr::vector<level> levels{&arena}; ///< Незакрытые множества от внешнего к внутреннему
+
+    /**
+     * @brief Добавляет элемент в текущее множество
+     * @param elem_to_add Элемент
+     * @details В ориентированное множество повтор не добавляется, в неориентированном
+     * повторы удаляются при закрытии.
+     */
+    void add(set_element);
+
+public:
+    /**
+     * @brief Открывает новое множество внутри текущего
+     * @param is_directed Флаг ориентированности
+     */
+    void open(bool);
+
+    /**
+     * @brief Добавляет букву в текущее множество
+     * @param atom Буква
+     */
+    void add_atom(char);
+
+    /**
+     * @brief Закрывает текущее множество
+     * @return Интернированный узел закрытого множества
+     * @details Если множество вложенное, узел также добавляется в родительское множество.
+     */
+    node_handle close();
+
+    /**
+     * @brief Возвращает количество незакрытых множеств
+     * @return Глубина текущего множества, 0 если множества не открыты
+     */
+    size_t depth() const;
+
+    /**
+     * @brief Проверяет, ориентировано ли текущее множество
+     * @return Флаг ориентированности текущего множества
+     */
+    bool is_directed() const;
+};
+
+/**
+ * @brief Разборщик записи множества за один проход
+ *
+ * @details Проход по std::string_view проверяет запись по тем же правилам, что и
+ * string_validator, и одновременно строит интернированные узлы через set_builder: каждое
+ * вложенное множество превращается в узел сразу после закрывающей скобки, без промежуточных
+ * строк и временных объектов cantor_set. Пробелы пропускаются, запятые служат разделителями.
+ * Открытые скобки хранятся в явном стеке, поэтому глубина вложенности не ограничена стеком вызовов.
+ *
+ * В отличие от string_validator, разборщик требует, чтобы закрывающая скобка совпадала
+ * по виду с открывающей, и не допускает символов после множества, кроме пробелов.
+ * При ошибке выбрасывается set_parse_error с позицией символа.
+ */
+class set_parser {
+private:
+    std::string_view text; ///< Разбираемая запись
+    size_t position = 0; ///< Позиция текущего символа
+
+    /**
+     * @brief Конструктор
+     * @param text Разбираемая запись, должна существовать до конца разбора
+     */
+    explicit set_parser(std::string_view);
+
+    /**
+     * @brief Выбрасывает ошибку разбора
+     * @param at Позиция ошибки
+     * @param message Описание ошибки
+     * @throw set_parse_error всегда
+     */
+    [[noreturn]] void fail(size_t, const std::string&) const;
+
+    /**
+     * @brief Проверяет символ и его сочетание со следующим символом
+     * @param at Позиция символа
+     * @throw set_parse_error если символ недопустим или за ним следует запрещенный символ
+     */
+    void check_character(size_t) const;
+
+    /**
+     * @brief Разбирает множество, открывающая скобка которого стоит в текущей позиции
+     * @return Интернированный узел множества
+     * @details После вызова текущая позиция стоит за закрывающей скобкой внешнего множества.
+     */
+    node_handle parse_nested();
+
+    /**
+     * @brief Разбирает запись целиком
+     * @param allow_directed Допускается ли ориентированное множество
+     * @return Интернированный узел множества
+     */
+    node_handle parse_whole(bool);
+
+public:
+    /**
+     * @brief Разбирает запись множества для set_manager
+     * @param text Запись вида {...}
+     * @return Интернированный узел множества
+     * @throw set_parse_error если запись неверна или множество ориентированное
+     */
+    static node_handle parse_set(std::string_view);
+
+    /**
+     * @brief Разбирает запись элемента множества
+     * @param text Буква 'a'-'z' или запись вида {...} или <...>
+     * @return Буква или интернированный узел
+     * @throw set_parse_error если запись неверна
+     */
+    static set_element parse_element(std::string_view);
+};
+
+#endif //SEM3_L1_PPOIS_P2_SET_PARSER_H
@@ -0,0 +1,212 @@
+#include "set_serializer.h"
+#include <algorithm>
+#include <memory_resource>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+    [[noreturn]] void damaged(const std::string& message) {
+        throw std::runtime_error("Поврежденные данные множеств: " + message);
+    }
+
+    /**
+     * Незаконченное множество при чтении: элементы копятся в арене чтения и
+     * передаются в set_pool::intern_sorted, когда прочитаны все remaining элементов.
+     */
+    struct read_frame {
+        bool is_directed;
+        uint64_t remaining;
+        size_t table_slot;
+        std::pmr::vector<set_element> elements;
+        element_index index;
+    };
+
+    size_t node_slot(const set_node* node, size_t mask) {
+        return (reinterpret_cast<uintptr_t>(node) * 0x9E3779B97F4A7C15ull >> 32) & mask;
+    }
+
+    void append_element(read_frame& frame, set_element elem_to_add) {
+        if (frame.is_directed) {
+            if (!set_pool::add_unique(frame.elements, frame.index, std::move(elem_to_add))) damaged("повтор элемента");
+            return;
+        }
+        if (!frame.elements.empty() && !set_pool::element_less(frame.elements.back(), elem_to_add))
+            damaged("нарушен порядок элементов");
+        frame.elements.push_back(std::move(elem_to_add));
+    }
+}
+
+set_writer::set_writer(std::ostream& output) : output(output), target(output.rdbuf()) {
+    if (!target) throw std::runtime_error("Не удалось записать множества");
+    for (char symbol : set_binary_format::magic) put(static_cast<uint8_t>(symbol));
+    put(set_binary_format::version);
+}
+
+void set_writer::put(uint8_t value) {
+    if (target->sputc(static_cast<char>(value)) == std::streambuf::traits_type::eof()) {
+        output.setstate(std::ios::badbit);
+        throw std::runtime_error("Не удалось записать множества");
+    }
+}
+
+void set_writer::put_varint(uint64_t value) {
+    while (value >= 0x80) {
+        put(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    put(static_cast<uint8_t>(value));
+}
+
+uint64_t set_writer::node_id(const set_node* node, bool& is_new) {
+    if ((written_nodes.size() + 1) * 2 > node_ids.size()) {
+        std::vector<std::pair<const set_node*, uint64_t>> old_ids(std::max<size_t>(64, node_ids.size() * 2));
+        node_ids.swap(old_ids);
+        size_t mask = node_ids.size() - 1;
+        for (const auto& entry : old_ids) {
+            if (!entry.first) continue;
+            size_t slot = node_slot(entry.first, mask);
+            while (node_ids[slot].first) slot = (slot + 1) & mask;
+            node_ids[slot] = entry;
+        }
+    }
+    size_t mask = node_ids.size() - 1;
+    size_t slot = node_slot(node, mask);
+    while (node_ids[slot].first && node_ids[slot].first != node) slot = (slot + 1) & mask;
+    is_new = !node_ids[slot].first;
+    if (is_new) node_ids[slot] = {node, written_nodes.size()};
+    return node_ids[slot].second;
+}
+
+const set_node* set_writer::put_element(const set_element& elem_to_write) {
+    if (elem_to_write.index() == 0) {
+        auto atom = static_cast<uint8_t>(std::get<0>(elem_to_write));
+        if (atom <= set_binary_format::atom_tag) put(set_binary_format::atom_tag);
+        put(atom);
+        return nullptr;
+    }
+    const node_handle& node = std::get<1>(elem_to_write);
+    bool is_new = false;
+    uint64_t id = node_id(node.get(), is_new);
+    if (!is_new) {
+        put(set_binary_format::reference_tag);
+        put_varint(id);
+        return nullptr;
+    }
+    written_nodes.push_back(node);
+    put(node->is_directed ? set_binary_format::directed_tag : set_binary_format::undirected_tag);
+    put_varint(node->elements.size());
+    return node->elements.empty() ? nullptr : node.get();
+}
+
+void set_writer::write(const cantor_set& set_to_write) {
+    if (finished) throw std::runtime_error("Запись множеств уже закончена");
+    std::vector<std::pair<const set_node*, size_t>> unfinished;
+    if (const set_node* root = put_element(set_to_write.get_node())) unfinished.emplace_back(root, 0);
+    while (!unfinished.empty()) {
+        auto& [node, position] = unfinished.back();
+        if (position == node->elements.size()) {
+            unfinished.pop_back();
+            continue;
+        }
+        if (const set_node* nested = put_element(node->elements[position++])) unfinished.emplace_back(nested, 0);
+    }
+}
+
+void set_writer::finish() {
+    if (finished) return;
+    put(set_binary_format::end_tag);
+    finished = true;
+    if (target->pubsync() == -1) {
+        output.setstate(std::ios::badbit);
+        throw std::runtime_error("Не удалось записать множества");
+    }
+}
+
+set_reader::set_reader(std::istream& input) : source(input.rdbuf()) {
+    if (!source) damaged("нет потока");
+    for (char symbol : set_binary_format::magic) {
+        if (get() != static_cast<uint8_t>(symbol)) damaged("неверный заголовок");
+    }
+    if (get() != set_binary_format::version) damaged("неизвестная версия формата");
+}
+
+uint8_t set_reader::get() {
+    int value = source->sbumpc();
+    if (value == std::streambuf::traits_type::eof()) damaged("неожиданный конец");
+    return static_cast<uint8_t>(value);
+}
+
+uint64_t set_reader::get_varint() {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        uint8_t current = get();
+        value |= static_cast<uint64_t>(current & 0x7f) << shift;
+        if (!(current & 0x80)) return value;
+    }
+    damaged("слишком длинное число");
+}
+
+node_handle set_reader::read_node(uint8_t tag) {
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::vector<read_frame> unfinished(&arena);
+    uint8_t current_tag = tag;
+    while (true) {
+        set_element value;
+        switch (current_tag) {
+            case set_binary_format::undirected_tag:
+            case set_binary_format::directed_tag: {
+                bool is_directed = current_tag == set_binary_format::directed_tag;
+                uint64_t size = get_varint();
+                node_table.emplace_back();
+                if (size > 0) {
+                    unfinished.push_back(read_frame{is_directed, size, node_table.size() - 1,
+                                                    std::pmr::vector<set_element>(&arena), {}});
+                    current_tag = get();
+                    continue;
+                }
+                node_table.back() = set_pool::instance().intern_sorted(is_directed, std::pmr::vector<set_element>());
+                value = node_table.back();
+                break;
+            }
+            case set_binary_format::reference_tag: {
+                uint64_t id = get_varint();
+                if (id >= node_table.size() || !node_table[id]) damaged("ссылка на неизвестный узел");
+                value = node_table[id];
+                break;
+            }
+            case set_binary_format::end_tag:
+                damaged("конец потока внутри множества");
+            case set_binary_format::atom_tag:
+                value = static_cast<char>(get());
+                break;
+            default:
+                value = static_cast<char>(current_tag);
+                break;
+        }
+        while (!unfinished.empty()) {
+            read_frame& top = unfinished.back();
+            append_element(top, std::move(value));
+            if (top.elements.size() < top.remaining) break;
+            node_handle node = set_pool::instance().intern_sorted(top.is_directed, top.elements);
+            node_table[top.table_slot] = node;
+            unfinished.pop_back();
+            value = std::move(node);
+        }
+        if (unfinished.empty()) return std::get<1>(value);
+        current_tag = get();
+    }
+}
+
+bool set_reader::read(cantor_set& set_to_read) {
+    if (finished) return false;
+    uint8_t tag = get();
+    if (tag == set_binary_format::end_tag) {
+        finished = true;
+        return false;
+    }
+    if (tag != set_binary_format::undirected_tag && tag != set_binary_format::directed_tag &&
+        tag != set_binary_format::reference_tag)
+        damaged("ожидалось множество");
+    set_to_read = cantor_set(read_node(tag));
+    return true;
+}
@@ -0,0 +1,165 @@
+/**
+ * @file set_serializer.h
+ * @brief Заголовочный файл двоичной записи и чтения канторовских множеств
+ * @author Ященко Александра
+ */
+
+#ifndef SEM3_L1_PPOIS_P2_SET_SERIALIZER_H
+#define SEM3_L1_PPOIS_P2_SET_SERIALIZER_H
+
+#include <cstdint>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <utility>
+#include <vector>
+#include "set.h"
+
+/**
+ * @brief Константы двоичного формата множеств
+ *
+ * @details Поток начинается с заголовка "CSET" и номера версии, затем идут множества
+ * и байт end_tag. Каждое множество записывается в прямом порядке обхода: байт-тег,
+ * для множества - длина в формате varint (по 7 бит, старший бит - признак продолжения)
+ * и элементы. Каждый записанный узел получает следующий номер, и повторная встреча
+ * того же узла в любом месте потока кодируется тегом reference_tag с номером, поэтому
+ * общие поддеревья хранятся один раз. Буква, код которой не совпадает со служебным
+ * тегом, записывается одним байтом, иначе - тегом atom_tag и самой буквой.
+ */
+struct set_binary_format {
+    static constexpr char magic[4] = {'C', 'S', 'E', 'T'}; ///< Метка начала потока
+    static constexpr uint8_t version = 1; ///< Версия формата
+
+    static constexpr uint8_t end_tag = 0; ///< Конец потока
+    static constexpr uint8_t undirected_tag = 1; ///< Неориентированное множество
+    static constexpr uint8_t directed_tag = 2; ///< Ориентированное множество
+    static constexpr uint8_t reference_tag = 3; ///< Ссылка на ранее записанный узел
+    static constexpr uint8_t atom_tag = 4; ///< Буква со служебным кодом
+};
+
+/**
+ * @brief Потоковая двоичная запись множеств
+ *
+ * @details Множества записываются по одному сразу в std::streambuf потока, без
+ * промежуточного текста. Таблица номеров узлов общая для всего потока и держит
+ * ссылки на записанные узлы, чтобы их адреса не были заняты новыми узлами;
+ * номера ищутся в плоской таблице с линейным пробированием, как в element_index.
+ * Обход выполняется с явным стеком.
+ */
+class set_writer {
+private:
+    std::ostream& output; ///< Поток вывода
+    std::streambuf* target; ///< Буфер потока вывода
+    std::vector<std::pair<const set_node*, uint64_t>> node_ids; ///< Открытая адресация: узел и его номер
+    std::vector<node_handle> written_nodes; ///< Записанные узлы
+    bool finished = false; ///< Записан ли конец потока
+
+    /**
+     * @brief Записывает байт
+     * @param value Байт
+     * @throw std::runtime_error если запись не удалась
+     */
+    void put(uint8_t);
+
+    /**
+     * @brief Записывает число в формате varint
+     * @param value Число
+     */
+    void put_varint(uint64_t);
+
+    /**
+     * @brief Ищет номер узла и добавляет узел в таблицу, если его там нет
+     * @param node Узел
+     * @param is_new Становится true, если узел добавлен
+     * @return Номер узла
+     */
+    uint64_t node_id(const set_node*, bool&);
+
+    /**
+     * @brief Записывает элемент без вложенных элементов
+     * @param elem_to_write Элемент
+     * @return Узел, элементы которого нужно записать следом, или nullptr
+     */
+    const set_node* put_element(const set_element&);
+
+public:
+    /**
+     * @brief Конструктор, записывает заголовок
+     * @param output Поток вывода, открытый в двоичном режиме
+     * @throw std::runtime_error если запись не удалась
+     */
+    explicit set_writer(std::ostream&);
+
+    set_writer(const set_writer&) = delete;
+    set_writer& operator=(const set_writer&) = delete;
+
+    /**
+     * @brief Записывает множество
+     * @param set_to_write Множество
+     * @throw std::runtime_error если запись не удалась или поток уже закончен
+     */
+    void write(const cantor_set&);
+
+    /**
+     * @brief Записывает конец потока
+     * @throw std::runtime_error если запись не удалась
+     * @details Повторный вызов ничего не делает.
+     */
+    void finish();
+};
+
+/**
+ * @brief Потоковое чтение множеств в двоичном формате
+ *
+ * @details Множества читаются по одному; узлы создаются через set_pool сразу из
+ * прочитанных элементов, ссылки на общие поддеревья разрешаются по таблице номеров.
+ * Порядок элементов неориентированных множеств и отсутствие повторов проверяются,
+ * поэтому поврежденный поток не может нарушить канонический порядок узлов.
+ * Байты после конца потока не читаются.
+ */
+class set_reader {
+private:
+    std::streambuf* source; ///< Буфер потока ввода
+    std::vector<node_handle> node_table; ///< Узлы по номерам, nullptr для еще не прочитанных
+    bool finished = false; ///< Прочитан ли конец потока
+
+    /**
+     * @brief Читает байт
+     * @return Байт
+     * @throw std::runtime_error если поток закончился
+     */
+    uint8_t get();
+
+    /**
+     * @brief Читает число в формате varint
+     * @return Число
+     * @throw std::runtime_error если число записано неверно
+     */
+    uint64_t get_varint();
+
+    /**
+     * @brief Читает узел, тег которого уже прочитан
+     * @param tag Тег undirected_tag, directed_tag или reference_tag
+     * @return Узел
+     * @throw std::runtime_error если данные повреждены
+     */
+    node_handle read_node(uint8_t);
+
+public:
+    /**
+     * @brief Конструктор, читает и проверяет заголовок
+     * @param input Поток ввода, открытый в двоичном режиме
+     * @throw std::runtime_error если заголовок неверен
+     */
+    explicit set_reader(std::istream&);
+
+    /**
+     * @brief Читает следующее множество
+     * @param set_to_read Множество, которое заменяется прочитанным
+     * @return true, если множество прочитано, false в конце потока
+     * @throw std::runtime_error если данные повреждены
+     */
+    bool read(cantor_set&);
+};
+
+#endif //SEM3_L1_PPOIS_P2_SET_SERIALIZER_H
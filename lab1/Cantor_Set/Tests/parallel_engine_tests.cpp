@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include "parallel_engine.h"
+#include "power_set.h"
+
+class ParallelEngineTest : public ::testing::Test {
+protected:
+    static std::string numbered_element(size_t number) {
+        std::string element;
+        for (size_t level = 0; level < 3; ++level) {
+            element += '{';
+            element += static_cast<char>('a' + number % 26);
+            number /= 26;
+        }
+        return element + "}}}";
+    }
+
+    static cantor_set numbered_set(char start_brace, size_t first, size_t last) {
+        std::string text(1, start_brace);
+        for (size_t number = last; number > first; --number) text += numbered_element(number - 1);
+        return cantor_set(text + (start_brace == '{' ? "}" : ">"));
+    }
+};
+
+TEST_F(ParallelEngineTest, PowerSetMatchesSequential) {
+    cantor_set set("<dba{c}e{ab}gf>");
+    cantor_set expected = set.set_boolean(set);
+    std::ostringstream expected_output;
+    power_set_generator(set).write_to(expected_output);
+
+    for (size_t thread_number : {1, 3, 8}) {
+        parallel_engine engine(thread_number);
+        EXPECT_EQ(engine.get_thread_number(), thread_number);
+        EXPECT_EQ(engine.power_set(set), expected);
+        std::ostringstream output;
+        engine.write_power_set(set, output);
+        EXPECT_EQ(output.str(), expected_output.str());
+    }
+}
+
+TEST_F(ParallelEngineTest, LargeSetOperationsMatchSequential) {
+    cantor_set first_set = numbered_set('{', 0, 6000);
+    cantor_set second_set = numbered_set('{', 3000, 9000);
+    cantor_set directed_set = numbered_set('<', 4000, 7000);
+    for (size_t thread_number : {1, 4}) {
+        parallel_engine engine(thread_number);
+        EXPECT_EQ(engine.set_union(first_set, second_set), first_set + second_set);
+        EXPECT_EQ(engine.set_intersection(first_set, second_set), first_set * second_set);
+        EXPECT_EQ(engine.set_difference(first_set, second_set), first_set - second_set);
+        EXPECT_EQ(engine.set_union(first_set, directed_set), first_set + directed_set);
+        EXPECT_EQ(engine.set_union(directed_set, first_set), directed_set + first_set);
+        EXPECT_EQ(engine.set_intersection(directed_set, first_set), directed_set * first_set);
+        EXPECT_EQ(engine.set_difference(directed_set, second_set), directed_set - second_set);
+    }
+    EXPECT_EQ(parallel_engine(4).set_intersection(first_set, second_set).set_length(), 3000);
+}
+
+TEST_F(ParallelEngineTest, PowerSetOfHugeSetThrows) {
+    std::string elements_string = "{";
+    for (char letter = 'a'; letter <= 'z'; ++letter) elements_string += std::string(1, letter) + "{" + letter + "}<" + letter + ">";
+    cantor_set huge_set(elements_string + "}");
+    EXPECT_THROW(parallel_engine(2).power_set(huge_set), std::overflow_error);
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include "power_set.h"
+#include "string_validator.h"
+
+class PowerSetTest : public ::testing::Test {
+protected:
+    cantor_set parse_printed(std::string printed_set) {
+        EXPECT_TRUE(string_validator::set_read(printed_set, false));
+        return cantor_set(printed_set);
+    }
+};
+
+TEST_F(PowerSetTest, GeneratesAllSubsetsInGrayOrder) {
+    cantor_set set("{c{ab}a}");
+    power_set_generator generator(set);
+    EXPECT_EQ(generator.cardinality(), 8u);
+
+    std::vector<std::string> subsets;
+    cantor_set previous('{');
+    while (generator.has_next()) {
+        cantor_set subset = generator.next();
+        if (!subsets.empty()) {
+            cantor_set removed = previous - subset;
+            cantor_set changed = (subset - previous) + removed;
+            EXPECT_EQ(changed.set_length(), 1);
+        }
+        subsets.push_back(cantor_set::print_helper(subset));
+        previous = subset;
+    }
+    std::vector<std::string> expected = {"{}", "{a}", "{a,c}", "{c}", "{c,{a,b}}", "{a,c,{a,b}}", "{a,{a,b}}", "{{a,b}}"};
+    EXPECT_EQ(subsets, expected);
+    EXPECT_EQ(generator.changed_position(), 0u);
+    EXPECT_THROW(generator.next(), std::out_of_range);
+}
+
+TEST_F(PowerSetTest, MatchesSetBoolean) {
+    cantor_set set("<dba{c}>");
+    std::ostringstream output;
+    power_set_generator(set).write_to(output);
+    EXPECT_EQ(parse_printed(output.str()), set.set_boolean(set));
+
+    cantor_set empty_set('{');
+    std::ostringstream empty_output;
+    power_set_generator(empty_set).write_to(empty_output);
+    EXPECT_EQ(empty_output.str(), "{{}}");
+}
+
+TEST_F(PowerSetTest, CardinalityOfLargeSets) {
+    std::string elements_string = "{";
+    for (char letter = 'a'; letter <= 't'; ++letter) elements_string += std::string(1, letter) + "{" + letter + "}";
+    cantor_set set(elements_string + "}");
+    power_set_generator generator(set);
+    EXPECT_EQ(generator.cardinality(), uint64_t(1) << 40);
+    EXPECT_TRUE(generator.next().is_empty());
+    EXPECT_EQ(generator.next().set_length(), 1);
+
+    for (char letter = 'a'; letter <= 'z'; ++letter) elements_string += std::string("<") + letter + ">";
+    power_set_generator huge_generator(cantor_set(elements_string + "}"));
+    EXPECT_THROW(huge_generator.cardinality(), std::overflow_error);
+    EXPECT_TRUE(huge_generator.has_next());
+}
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include "set_manager.h"
 #include "set.h"
+#include <sstream>
+#include <stdexcept>
 
 
 class SetManagerTest : public ::testing::Test {
@@ -68,6 +70,38 @@ TEST_F(SetManagerTest, SetBoolean) {
     EXPECT_FALSE(result.is_empty());
 }
 
+TEST_F(SetManagerTest, LazySetBoolean) {
+    EXPECT_EQ(manager.boolean_cardinality(1), 8u);
+    power_set_generator generator = manager.boolean_generator(1);
+    size_t subset_number = 0;
+    while (generator.has_next()) {
+        cantor_set subset = generator.next();
+        EXPECT_LE(subset.set_length(), 3);
+        subset_number++;
+    }
+    EXPECT_EQ(subset_number, 8);
+
+    std::ostringstream output;
+    manager.print_boolean(1, output);
+    EXPECT_EQ(output.str(), "{{},{e},{e,f},{f},{f,g},{e,f,g},{e,g},{g}}");
+}
+
+TEST_F(SetManagerTest, PrintBoolean_TooManyElementsThrowsWithoutOutput) {
+    set_manager local_manager;
+    std::string text = "{";
+    for (size_t depth = 0; depth < 64; ++depth) {
+        if (depth > 0) text += ',';
+        text += std::string(depth, '{') + "a" + std::string(depth, '}');
+    }
+    text += '}';
+    local_manager.create_set_help(text);
+
+    std::ostringstream output;
+    EXPECT_THROW(local_manager.boolean_cardinality(0), std::overflow_error);
+    EXPECT_THROW(local_manager.print_boolean(0, output), std::overflow_error);
+    EXPECT_TRUE(output.str().empty());
+}
+
 TEST_F(SetManagerTest, FindSetExists) {
     set_manager local_manager;
     local_manager.create_set_help("{k,l,m}");
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "set.h"
+#include "set_manager.h"
+#include "set_parser.h"
+#include "string_validator.h"
+
+class SetParserTest : public ::testing::Test {
+protected:
+    size_t error_position(const std::string& text, bool is_element) {
+        try {
+            if (is_element) set_parser::parse_element(text);
+            else set_parser::parse_set(text);
+        } catch (const set_parse_error& exception) {
+            return exception.position();
+        }
+        ADD_FAILURE() << "запись принята: " << text;
+        return SIZE_MAX;
+    }
+};
+
+TEST_F(SetParserTest, MatchesValidatorPath) {
+    const std::vector<std::string> inputs = {"{}", "{a,b,c}", "{a, b , c}", "{c,b,a,a}", "{a{b}}", "{a,{b,<c,d>}}",
+                                             "{<a,b,a>,{}}", "{a<b>c}", "{{a,b},{b,a}}", "{<>,<<>>}"};
+    for (const std::string& input : inputs) {
+        std::string validated = input;
+        ASSERT_TRUE(string_validator::set_read(validated, false)) << input;
+        EXPECT_EQ(cantor_set::parse(input), cantor_set(validated)) << input;
+    }
+    EXPECT_EQ(cantor_set::print_helper(cantor_set::parse("{c, {b,a}, a}")), "{a,c,{a,b}}");
+    EXPECT_EQ(cantor_set::print_helper(cantor_set::parse("{<b,a,b>}")), "{<b,a>}");
+}
+
+TEST_F(SetParserTest, ParsesElements) {
+    EXPECT_EQ(set_parser::parse_element("a"), set_element('a'));
+    cantor_set directed("<ba>");
+    EXPECT_EQ(set_parser::parse_element("<b,a>"), set_element(directed.get_node()));
+    EXPECT_EQ(set_parser::parse_element("<b,a> "), set_element(directed.get_node()));
+    EXPECT_THROW(set_parser::parse_set("<a>"), set_parse_error);
+    EXPECT_THROW(set_parser::parse_element("A"), std::invalid_argument);
+}
+
+TEST_F(SetParserTest, ReportsErrorPositions) {
+    EXPECT_EQ(error_position("", false), 0u);
+    EXPECT_EQ(error_position(" {a}", false), 0u);
+    EXPECT_EQ(error_position("{a,,b}", false), 3u);
+    EXPECT_EQ(error_position("{ab}", false), 2u);
+    EXPECT_EQ(error_position("{a,B}", false), 3u);
+    EXPECT_EQ(error_position("{a,{b}", false), 6u);
+    EXPECT_EQ(error_position("{<a}>", false), 3u);
+    EXPECT_EQ(error_position("{a}b", false), 3u);
+    EXPECT_EQ(error_position("{a,}", false), 3u);
+    EXPECT_EQ(error_position("<{a>}", true), 3u);
+
+    try {
+        set_parser::parse_set("{a,,b}");
+    } catch (const set_parse_error& exception) {
+        EXPECT_EQ(std::string(exception.what()), "Ошибка в позиции 4: символ ',' не может следовать за ','");
+    }
+}
+
+TEST_F(SetParserTest, UsedBySetManagerAndElements) {
+    set_manager manager;
+    EXPECT_TRUE(manager.create_set_help("{a, b}"));
+    EXPECT_FALSE(manager.create_set_help("{b,a}"));
+    EXPECT_THROW(manager.create_set_help("{a}}"), set_parse_error);
+    EXPECT_EQ(manager.get_set_count(), 1u);
+
+    cantor_set& set = manager.get_set(0);
+    EXPECT_TRUE(set.add_helper("{c, <d,e>}"));
+    EXPECT_TRUE(set["{<d,e>,c}"]);
+    EXPECT_THROW(set.add_helper("{c"), set_parse_error);
+    EXPECT_TRUE(set.delete_helper("{c,<d,e>}"));
+    EXPECT_EQ(cantor_set::print_helper(set), "{a,b}");
+}
+
+TEST_F(SetParserTest, MillionLevelNesting) {
+    const size_t depth = 1000000;
+    std::string text = std::string(depth, '{') + std::string(depth, '}');
+    EXPECT_EQ(error_position(text.substr(0, text.size() - 1), false), 2 * depth - 1);
+    EXPECT_EQ(error_position(std::string(depth, '<') + "a" + std::string(depth, '}'), true), depth + 1);
+
+    set_manager manager;
+    EXPECT_TRUE(manager.create_set_help(text));
+    EXPECT_FALSE(manager.create_set_help(text));
+    EXPECT_TRUE(manager.get_set(0)[text.substr(1, text.size() - 2)]);
+}
+
+TEST_F(SetParserTest, BuilderReusesInternedNodes) {
+    cantor_set existing("{a{b}<c>}");
+    size_t nodes_before = set_pool::instance().node_count();
+    std::pmr::vector<set_element> elements(existing.get_node()->elements.begin(), existing.get_node()->elements.end());
+    EXPECT_EQ(set_pool::instance().intern_sorted(false, elements), existing.get_node());
+    EXPECT_EQ(cantor_set::parse("{<c>,{b},a}"), existing);
+    EXPECT_EQ(set_pool::instance().node_count(), nodes_before);
+
+    std::string directed = "<";
+    for (char atom = 'a'; atom <= 'z'; ++atom) directed += std::string(1, atom) + ",";
+    for (char atom = 'z'; atom >= 'a'; --atom) directed += std::string(1, atom) + ",";
+    directed.back() = '>';
+    EXPECT_EQ(std::get<1>(set_parser::parse_element(directed))->elements.size(), 26u);
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include "set_manager.h"
+#include "set_serializer.h"
+
+using namespace std::string_literals;
+
+class SetSerializerTest : public ::testing::Test {
+protected:
+    std::string encode(const std::vector<cantor_set>& sets) {
+        std::ostringstream output(std::ios::binary);
+        set_writer writer(output);
+        for (const cantor_set& set : sets) writer.write(set);
+        writer.finish();
+        return output.str();
+    }
+
+    std::vector<cantor_set> decode(const std::string& data) {
+        std::istringstream input(data, std::ios::binary);
+        set_reader reader(input);
+        std::vector<cantor_set> sets;
+        cantor_set current('{');
+        while (reader.read(current)) sets.push_back(current);
+        return sets;
+    }
+
+    std::string header() {
+        return std::string(set_binary_format::magic, 4) + char(set_binary_format::version);
+    }
+};
+
+TEST_F(SetSerializerTest, RoundTrip) {
+    std::vector<cantor_set> sets = {cantor_set("{}"), cantor_set("{abc}"), cantor_set("<cab<>{}>"),
+                                    cantor_set("{a{b<cd>}<{}a>}"), cantor_set(std::string("{\x01\x04z}"))};
+    std::vector<cantor_set> decoded = decode(encode(sets));
+    ASSERT_EQ(decoded.size(), sets.size());
+    for (size_t i = 0; i < sets.size(); ++i) EXPECT_EQ(decoded[i], sets[i]);
+}
+
+TEST_F(SetSerializerTest, SharedSubtreesWrittenOnce) {
+    std::string element = "{a{b{c{d}}}}";
+    cantor_set single("{" + element + "}");
+    cantor_set repeated("{x" + element + "<" + element + element + "y>}");
+    std::string data = encode({single, repeated, single});
+    EXPECT_EQ(data, header() + "\x01\x01" + "\x01\x02" "a" "\x01\x02" "b" "\x01\x02" "c" "\x01\x01" "d"
+                    "\x01\x03" "x" "\x03\x01" "\x02\x02" "\x03\x01" "y" "\x03\x00" "\x00"s);
+    std::vector<cantor_set> decoded = decode(data);
+    ASSERT_EQ(decoded.size(), 3u);
+    EXPECT_EQ(decoded[1], repeated);
+    EXPECT_EQ(decoded[2].get_node(), single.get_node());
+}
+
+TEST_F(SetSerializerTest, DeepNesting) {
+    const size_t depth = 200000;
+    cantor_set deep(std::string(depth, '{') + "a" + std::string(depth, '}'));
+    std::vector<cantor_set> decoded = decode(encode({deep}));
+    ASSERT_EQ(decoded.size(), 1u);
+    EXPECT_EQ(decoded[0], deep);
+}
+
+TEST_F(SetSerializerTest, StopsAtEndOfStream) {
+    std::string data = encode({cantor_set("{a}")}) + "tail";
+    std::istringstream input(data, std::ios::binary);
+    set_reader reader(input);
+    cantor_set current('{');
+    EXPECT_TRUE(reader.read(current));
+    EXPECT_FALSE(reader.read(current));
+    std::string rest;
+    input >> rest;
+    EXPECT_EQ(rest, "tail");
+}
+
+TEST_F(SetSerializerTest, RejectsDamagedData) {
+    EXPECT_THROW(decode("CSEX\x01"), std::runtime_error);
+    EXPECT_THROW(decode(header() + "\x01\x02" "a"), std::runtime_error);
+    EXPECT_THROW(decode(header() + "\x01\x02" "ba" + std::string(1, '\0')), std::runtime_error);
+    EXPECT_THROW(decode(header() + "\x02\x02" "aa" + std::string(1, '\0')), std::runtime_error);
+    EXPECT_THROW(decode(header() + "\x01\x01\x03\x05" + std::string(1, '\0')), std::runtime_error);
+    EXPECT_THROW(decode(header() + "a" + std::string(1, '\0')), std::runtime_error);
+}
+
+TEST_F(SetSerializerTest, SetManagerSaveAndLoad) {
+    set_manager manager;
+    manager.create_set_help("{a,b,{c,<d,e>}}");
+    manager.create_set_help("{{c,<d,e>},f}");
+    manager.create_set_help("{}");
+    std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+    manager.save(stream);
+
+    set_manager restored;
+    restored.create_set_help("{}");
+    EXPECT_EQ(restored.load(stream), 2u);
+    EXPECT_EQ(restored.list_all_sets(), std::vector<std::string>({"{}", "{a,b,{c,<d,e>}}", "{f,{c,<d,e>}}"}));
+
+    std::string directed = encode({cantor_set::parse("{g,h}"), cantor_set("<ab>")});
+    std::istringstream directed_input(directed, std::ios::binary);
+    EXPECT_THROW(restored.load(directed_input), std::runtime_error);
+    EXPECT_EQ(restored.get_set_count(), 3u);
+}
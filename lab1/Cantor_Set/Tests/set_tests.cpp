@@ -256,3 +256,131 @@ TEST_F(CantorSetTest, MixedTypes) {
     cantor_set set("{a{b}c}");
     EXPECT_EQ(set.set_length(), 3);
 }
+
+TEST_F(CantorSetTest, IdenticalNestedSetsShareNode) {
+    cantor_set set1("{a{bc}}");
+    cantor_set set2("<d{bc}>");
+    const node_handle& nested1 = std::get<1>(set1.get_node()->elements[1]);
+    const node_handle& nested2 = std::get<1>(set2.get_node()->elements[1]);
+    EXPECT_EQ(nested1.get(), nested2.get());
+    EXPECT_EQ(cantor_set("{a{bc}}").get_node(), set1.get_node());
+}
+
+TEST_F(CantorSetTest, CopySharesNodeUntilChanged) {
+    cantor_set set1("{a{bc}}");
+    cantor_set set2 = set1;
+    EXPECT_EQ(set1.get_node(), set2.get_node());
+
+    EXPECT_TRUE(set2.add_helper("z"));
+    EXPECT_NE(set1.get_node(), set2.get_node());
+    EXPECT_EQ(set1.set_length(), 2);
+    EXPECT_EQ(set2.set_length(), 3);
+}
+
+TEST_F(CantorSetTest, PoolReleasesUnusedNodes) {
+    size_t nodes_before = set_pool::instance().node_count();
+    {
+        cantor_set set("{x{y<wv>}}");
+        EXPECT_EQ(set_pool::instance().node_count(), nodes_before + 3);
+    }
+    EXPECT_EQ(set_pool::instance().node_count(), nodes_before);
+}
+
+TEST_F(CantorSetTest, UndirectedSetsUseCanonicalOrder) {
+    cantor_set set1("{c<ed>b{ed}a}");
+    EXPECT_EQ(cantor_set::print_helper(set1), "{a,b,c,{d,e},<e,d>}");
+    EXPECT_EQ(set1.get_node(), cantor_set("{{de}a<ed>cb}").get_node());
+
+    cantor_set directed_set("<cba>");
+    EXPECT_EQ(cantor_set::print_helper(directed_set), "<c,b,a>");
+}
+
+TEST_F(CantorSetTest, MergeOperationsKeepOrder) {
+    cantor_set directed_set("<ca>");
+    cantor_set set1("{dbc}");
+    EXPECT_EQ(cantor_set::print_helper(directed_set + set1), "<c,a,b,d>");
+    EXPECT_EQ(cantor_set::print_helper(set1 + directed_set), "{a,b,c,d}");
+    EXPECT_EQ(cantor_set::print_helper(directed_set * set1), "{c}");
+    EXPECT_EQ(cantor_set::print_helper(set1 - directed_set), "{b,d}");
+
+    cantor_set set2("{b{xy}}");
+    set2 += set1;
+    EXPECT_EQ(cantor_set::print_helper(set2), "{b,c,d,{x,y}}");
+    EXPECT_TRUE(set2["{y,x}"]);
+    EXPECT_FALSE(set2["a"]);
+}
+
+TEST_F(CantorSetTest, StructuralHash) {
+    EXPECT_EQ(cantor_set("{ab{cd}}").get_hash(), cantor_set("{{dc}ba}").get_hash());
+    EXPECT_NE(cantor_set("<ab>").get_hash(), cantor_set("<ba>").get_hash());
+    EXPECT_EQ(std::hash<cantor_set>{}(cantor_set("<ab>")), cantor_set("<ab>").get_hash());
+}
+
+TEST_F(CantorSetTest, LargeSetsUseIndex) {
+    std::string elements_string = "<";
+    for (char letter = 'z'; letter >= 'a'; --letter) elements_string += std::string("{") + letter + "}" + letter;
+    elements_string += "{z}a>";
+    cantor_set set(elements_string);
+    ASSERT_NE(set.get_node()->index, nullptr);
+    EXPECT_EQ(set.set_length(), 52);
+    EXPECT_TRUE(set["{q}"]);
+    EXPECT_TRUE(set["q"]);
+    EXPECT_FALSE(set["{q,r}"]);
+
+    EXPECT_FALSE(set.add_helper("{z}"));
+    EXPECT_TRUE(set.add_helper("{q,r}"));
+    EXPECT_TRUE(set["{r,q}"]);
+    EXPECT_TRUE(set.delete_helper("{q}"));
+    EXPECT_FALSE(set["{q}"]);
+    EXPECT_EQ(set.set_length(), 52);
+    EXPECT_EQ(cantor_set::print_helper(set).substr(0, 10), "<{z},z,{y}");
+}
+
+TEST_F(CantorSetTest, AtomMask) {
+    cantor_set set1("{cab{x}}");
+    EXPECT_EQ(set1.get_node()->atom_mask, 0b111u);
+    EXPECT_EQ(set1.get_node()->atom_number, 3u);
+    EXPECT_TRUE(set1.get_node()->has_mask_atoms());
+    EXPECT_TRUE(set1["b"]);
+    EXPECT_FALSE(set1["d"]);
+    EXPECT_TRUE(set1.delete_helper("a"));
+    EXPECT_EQ(set1.get_node()->atom_mask, 0b110u);
+
+    EXPECT_FALSE(cantor_set("<ab>").get_node()->has_mask_atoms());
+    EXPECT_FALSE(createSimpleSet().get_node()->has_mask_atoms());
+}
+
+TEST_F(CantorSetTest, AtomMaskOperations) {
+    cantor_set set1("{abz{x}{y}}");
+    cantor_set set2("{bcz{y}}");
+    EXPECT_EQ(cantor_set::print_helper(set1 + set2), "{a,b,c,z,{x},{y}}");
+    EXPECT_EQ(cantor_set::print_helper(set1 * set2), "{b,z,{y}}");
+    EXPECT_EQ(cantor_set::print_helper(set1 - set2), "{a,{x}}");
+    EXPECT_EQ((set1 + set2).get_node()->atom_mask, (1u << 25) | 0b111u);
+
+    cantor_set set3 = cantor_set::parse("{a,b,c}");
+    EXPECT_EQ(cantor_set::print_helper(set1 * set3), "{a,b}");
+    EXPECT_EQ(cantor_set::print_helper(set3 - set1), "{c}");
+}
+
+TEST_F(CantorSetTest, MillionLevelNesting) {
+    const size_t depth = 1000000;
+    std::string first_text = std::string(depth, '{') + "a" + std::string(depth, '}');
+    std::string second_text = std::string(depth, '{') + "b" + std::string(depth, '}');
+    size_t nodes_before = set_pool::instance().node_count();
+    {
+        cantor_set first(first_text);
+        cantor_set second = cantor_set::parse(second_text);
+        EXPECT_EQ(cantor_set::parse(first_text), first);
+        EXPECT_NE(first, second);
+        EXPECT_LT(set_pool::compare_elements(first.get_node(), second.get_node()), 0);
+        EXPECT_EQ(cantor_set::print_helper(first), first_text);
+
+        cantor_set both = first + second;
+        EXPECT_EQ(both.set_length(), 2);
+        EXPECT_EQ(set_pool::instance().node_count(), nodes_before + 2 * depth + 1);
+        EXPECT_TRUE(both.delete_helper(first_text.substr(1, first_text.size() - 2)));
+        EXPECT_EQ(both, second);
+    }
+    EXPECT_EQ(set_pool::instance().node_count(), nodes_before);
+}
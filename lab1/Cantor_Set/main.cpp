@@ -6,7 +6,9 @@
 
 #include <iostream>
 #include <string>
+#ifdef _WIN32
 #include <windows.h>
+#endif
 #include <limits>
 #include "Cantor_set/set.h"
 #include "Cantor_set/set_manager.h"
@@ -330,8 +332,14 @@ void get_boolean(set_manager& set_manager_){
     }
     std::cout << "Укажите номер множества для нахождения булеана. ";
     size_t set_number=input_set_number(set_manager_);
-    std::cout << "Булеан множества: ";
-    std::cout << cantor_set::print_helper(set_manager_.set_boolean(set_number)) << "\n";
+    try {
+        uint64_t subset_number = set_manager_.boolean_cardinality(set_number);
+        std::cout << "Булеан множества (" << subset_number << " подмножеств): ";
+        set_manager_.print_boolean(set_number, std::cout);
+        std::cout << "\n";
+    } catch (const std::exception &exception) {
+        std::cout << "Ошибка при построении булеана: " << exception.what() << "\n";
+    }
 }
 
 /**
@@ -342,8 +350,10 @@ void get_boolean(set_manager& set_manager_){
  */
 int main() {
 
+#ifdef _WIN32
     SetConsoleOutputCP(65001);
     SetConsoleCP(65001);
+#endif
     set_manager set_manager_;
 
     while(true){
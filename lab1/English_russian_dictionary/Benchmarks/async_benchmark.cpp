@@ -0,0 +1,39 @@
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include "benchmarks.h"
+#include "Async_dictionary.h"
+
+void run_async_benchmark() {
+    const size_t word_number = 500000;
+    const std::string file_name = "async_benchmark.txt";
+    {
+        std::ofstream output(file_name, std::ios::binary);
+        for (size_t i = 0; i < word_number; ++i) output << benchmark_word(i) << " - слово\n";
+    }
+    const std::string query_word = benchmark_word(word_number / 2);
+
+    std::cout << "[async] " << word_number << " слов в файле\n";
+    bool found = false;
+    double blocking_seconds = measure_seconds([&] {
+        dictionary dict;
+        dict.read_from_file(file_name);
+        found = dict.contains_word(query_word);
+    });
+    std::cout << "  read_from_file: первый поиск через " << blocking_seconds * 1000 << " мс (найдено " << found << ")\n";
+
+    dictionary previous;
+    previous += std::make_pair(query_word, std::string("слово"));
+    async_dictionary dict(previous);
+    double first_query_seconds = 0;
+    double ready_seconds = measure_seconds([&] {
+        first_query_seconds = measure_seconds([&] {
+            dict.load_async(file_name);
+            found = dict.contains_word(query_word);
+        });
+        dict.wait_ready();
+    });
+    std::cout << "  load_async: первый поиск по прежней версии через " << first_query_seconds * 1000
+              << " мс (найдено " << found << "), новая версия через " << ready_seconds * 1000 << " мс\n";
+    std::remove(file_name.c_str());
+}
@@ -0,0 +1,20 @@
+#include <iostream>
+#include <sstream>
+#include "benchmarks.h"
+#include "Batch_executor.h"
+
+void run_batch_benchmark() {
+    const size_t word_number = 100000;
+
+    std::string commands;
+    for (size_t i = 0; i < word_number; ++i) commands += "add " + benchmark_word(i) + " - слово\n";
+    for (size_t i = 0; i < word_number; i += 2) commands += "set " + benchmark_word(i) + " - перевод\n";
+    for (size_t i = 0; i < word_number; ++i) commands += "get " + benchmark_word(i) + "\n";
+    for (size_t i = 0; i < word_number; i += 3) commands += "del " + benchmark_word(i) + "\n";
+
+    dictionary dict;
+    std::ostringstream output;
+    std::istringstream command_stream(commands);
+    batch_report report = batch_executor(dict, output).execute(command_stream);
+    std::cout << "[batch] " << report;
+}
@@ -0,0 +1,39 @@
+/**
+ * @file benchmark_main.cpp
+ * @brief Точка входа для замеров производительности.
+ * @details Без аргументов запускает все замеры, иначе только перечисленные по имени.
+ */
+
+#include <iostream>
+#include <string>
+#include <map>
+#include <functional>
+#include "benchmarks.h"
+
+int main(int argc, char* argv[]) {
+    const std::map<std::string, std::function<void()>> benchmarks = {
+            {"lsm", run_lsm_benchmark},
+            {"journal", run_journal_benchmark},
+            {"phrase", run_phrase_benchmark},
+            {"bloom", run_bloom_benchmark},
+            {"batch", run_batch_benchmark},
+            {"export", run_export_benchmark},
+            {"parallel", run_parallel_benchmark},
+            {"sharded", run_sharded_benchmark},
+            {"multi", run_multi_benchmark},
+            {"async", run_async_benchmark},
+    };
+    if (argc == 1) {
+        for (const auto& [name, benchmark] : benchmarks) benchmark();
+        return 0;
+    }
+    for (int i = 1; i < argc; ++i) {
+        auto benchmark = benchmarks.find(argv[i]);
+        if (benchmark == benchmarks.end()) {
+            std::cerr << "Неизвестный замер: " << argv[i] << "\n";
+            return 1;
+        }
+        benchmark->second();
+    }
+    return 0;
+}
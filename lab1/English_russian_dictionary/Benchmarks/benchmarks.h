@@ -0,0 +1,90 @@
+/**
+ * @file benchmarks.h
+ * @author Ященко Александра
+ * @brief Общие объявления замеров производительности словаря.
+ */
+
+#ifndef SEM3_L1_PPOIS_BENCHMARKS_H
+#define SEM3_L1_PPOIS_BENCHMARKS_H
+
+#include <chrono>
+#include <string>
+
+/**
+ * @brief Измеряет время выполнения функции.
+ * @param function_ Функция без параметров.
+ * @return Время выполнения в секундах.
+ */
+template<typename function>
+double measure_seconds(function function_) {
+    auto start = std::chrono::steady_clock::now();
+    function_();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/**
+ * @brief Формирует уникальное английское слово по номеру.
+ * @param number Номер слова.
+ * @return Слово из латинских букв.
+ */
+inline std::string benchmark_word(size_t number) {
+    std::string word = "w";
+    do {
+        word += static_cast<char>('a' + number % 26);
+        number /= 26;
+    } while (number);
+    return word;
+}
+
+/**
+ * @brief Замер скорости записи в lsm_dictionary.
+ */
+void run_lsm_benchmark();
+
+/**
+ * @brief Замер скорости изменений journaled_dictionary с группировкой fsync и без нее.
+ */
+void run_journal_benchmark();
+
+/**
+ * @brief Замер поиска словарных фраз в тексте автоматом и перебором n-грамм.
+ */
+void run_phrase_benchmark();
+
+/**
+ * @brief Замер contains_word с фильтром Блума и без него при разной доле промахов.
+ */
+void run_bloom_benchmark();
+
+/**
+ * @brief Замер скорости пакетного выполнения команд.
+ */
+void run_batch_benchmark();
+
+/**
+ * @brief Замер выгрузки словаря через export_to в сравнении с operator<<.
+ */
+void run_export_benchmark();
+
+/**
+ * @brief Замер масштабирования parallel_reduce по числу потоков.
+ */
+void run_parallel_benchmark();
+
+/**
+ * @brief Замер смешанной нагрузки чтения и записи на sharded_dictionary из нескольких потоков.
+ */
+void run_sharded_benchmark();
+
+/**
+ * @brief Сравнение памяти и поиска для translation_list и std::vector<std::string>.
+ */
+void run_multi_benchmark();
+
+/**
+ * @brief Замер задержки до первого поиска при обычной и фоновой загрузке файла.
+ */
+void run_async_benchmark();
+
+#endif //SEM3_L1_PPOIS_BENCHMARKS_H
@@ -0,0 +1,50 @@
+#include <iostream>
+#include <random>
+#include <vector>
+#include "benchmarks.h"
+#include "Dictionary.h"
+
+void run_bloom_benchmark() {
+    const size_t word_number = 200000;
+    const size_t query_number = 1000000;
+
+    dictionary dict;
+    for (size_t i = 0; i < word_number; ++i) dict += std::make_pair(benchmark_word(2 * i), std::string("слово"));
+
+    std::cout << "[bloom] " << word_number << " слов, " << query_number << " запросов contains_word\n";
+    std::mt19937 generator(7);
+    for (double miss_share : {0.0, 0.3, 0.6, 0.9}) {
+        std::bernoulli_distribution is_miss(miss_share);
+        std::uniform_int_distribution<size_t> word_distribution(0, word_number - 1);
+        std::vector<std::string> queries;
+        queries.reserve(query_number);
+        for (size_t i = 0; i < query_number; ++i) {
+            size_t number = 2 * word_distribution(generator);
+            queries.push_back(benchmark_word(is_miss(generator) ? number + 1 : number));
+        }
+
+        std::cout << "  промахов " << miss_share * 100 << "%:\n";
+        for (int mode = 0; mode < 3; ++mode) {
+            if (mode == 0) dict.disable_key_filter();
+            else dict.enable_key_filter(0.01, mode == 2);
+            size_t found = 0;
+            double seconds = measure_seconds([&] {
+                for (const std::string& query : queries) found += dict.contains_word(query);
+            });
+            std::cout << "    " << (mode == 0 ? "без фильтра" : mode == 1 ? "фильтр Блума" : "блочный фильтр")
+                      << ": " << seconds * 1e9 / query_number << " нс/запрос, найдено " << found;
+            if (mode != 0) std::cout << ", память " << dict.get_key_filter_memory() / 1024 << " КБ";
+            std::cout << "\n";
+        }
+    }
+
+    for (bool blocked : {false, true}) {
+        bloom_filter filter(2 * word_number, 0.01, blocked);
+        for (size_t i = 0; i < word_number; ++i) filter.add(benchmark_word(2 * i));
+        size_t false_positives = 0;
+        for (size_t i = 0; i < word_number; ++i) false_positives += filter.possibly_contains(benchmark_word(2 * i + 1));
+        std::cout << "  ложные срабатывания (" << (blocked ? "блочный" : "обычный") << "): "
+                  << 100.0 * false_positives / word_number << "%, бит на слово "
+                  << static_cast<double>(filter.get_bit_number()) / word_number << "\n";
+    }
+}
@@ -0,0 +1,32 @@
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include "benchmarks.h"
+#include "Dictionary.h"
+
+void run_export_benchmark() {
+    const size_t word_number = 2000000;
+    const std::string file_name = "export_benchmark.txt";
+
+    dictionary dict;
+    for (size_t i = 0; i < word_number; ++i) dict += std::make_pair(benchmark_word(i), std::string("перевод"));
+
+    std::cout << "[export] " << word_number << " пар\n";
+    double stream_seconds = measure_seconds([&] {
+        std::ofstream output(file_name, std::ios::binary);
+        output << dict;
+    });
+    std::cout << "  operator<<: " << stream_seconds << " с\n";
+
+    for (auto [format, name] : {std::make_pair(export_format::plain, "plain"),
+                                std::make_pair(export_format::tsv, "tsv"),
+                                std::make_pair(export_format::json_lines, "json_lines")}) {
+        double seconds = measure_seconds([&] {
+            std::ofstream output(file_name, std::ios::binary);
+            dict.export_to(output, format);
+        });
+        std::cout << "  export_to(" << name << "): " << seconds << " с, в " << stream_seconds / seconds
+                  << " раз быстрее operator<<\n";
+    }
+    std::remove(file_name.c_str());
+}
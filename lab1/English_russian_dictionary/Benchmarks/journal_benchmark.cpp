@@ -0,0 +1,31 @@
+#include <iostream>
+#include <cstdio>
+#include "benchmarks.h"
+#include "Journaled_dictionary.h"
+
+void run_journal_benchmark() {
+    const size_t edit_number = 2000;
+    const std::string snapshot_file = "journal_benchmark_snapshot.txt";
+    const std::string journal_file = "journal_benchmark_journal.log";
+
+    std::cout << "[journal] " << edit_number << " изменений\n";
+    for (size_t sync_batch_size : {size_t(1), size_t(16), size_t(256), size_t(0)}) {
+        std::remove(snapshot_file.c_str());
+        std::remove(journal_file.c_str());
+        double seconds;
+        {
+            journaled_dictionary dict(snapshot_file, journal_file, sync_batch_size, 0);
+            seconds = measure_seconds([&] {
+                for (size_t i = 0; i < edit_number; ++i) {
+                    dict += std::make_pair(benchmark_word(i), std::string("слово"));
+                }
+                dict.sync();
+            });
+        }
+        std::cout << "  fsync каждые " << sync_batch_size << " записей"
+                  << (sync_batch_size == 0 ? " (fsync выключен)" : "") << ": "
+                  << edit_number / seconds << " изменений/с\n";
+    }
+    std::remove(snapshot_file.c_str());
+    std::remove(journal_file.c_str());
+}
@@ -0,0 +1,37 @@
+#include <iostream>
+#include <filesystem>
+#include "benchmarks.h"
+#include "Dictionary.h"
+#include "Lsm_dictionary.h"
+
+void run_lsm_benchmark() {
+    const size_t word_number = 100000;
+    const std::string directory = "lsm_benchmark_directory";
+    std::filesystem::remove_all(directory);
+
+    dictionary memory_dictionary;
+    double memory_seconds = measure_seconds([&] {
+        for (size_t i = 0; i < word_number; ++i) {
+            memory_dictionary += std::make_pair(benchmark_word(i), std::string("слово"));
+        }
+    });
+
+    double lsm_seconds;
+    {
+        lsm_dictionary log_dictionary(directory, 8192, 4);
+        lsm_seconds = measure_seconds([&] {
+            for (size_t i = 0; i < word_number; ++i) {
+                log_dictionary += std::make_pair(benchmark_word(i), std::string("слово"));
+            }
+        });
+    }
+    double recovery_seconds = measure_seconds([&] {
+        lsm_dictionary reopened(directory, 8192, 4);
+    });
+    std::filesystem::remove_all(directory);
+
+    std::cout << "[lsm] " << word_number << " вставок\n"
+              << "  dictionary (только память): " << word_number / memory_seconds << " вставок/с\n"
+              << "  lsm_dictionary (журнал + run-файлы): " << word_number / lsm_seconds << " вставок/с\n"
+              << "  восстановление после закрытия: " << recovery_seconds << " с\n";
+}
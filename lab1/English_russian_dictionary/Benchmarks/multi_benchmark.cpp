@@ -0,0 +1,83 @@
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "benchmarks.h"
+#include "Binary_tree.h"
+#include "Translation_list.h"
+
+namespace {
+    size_t string_heap_bytes(const std::string& value) {
+        return value.capacity() > std::string().capacity() ? value.capacity() + 1 : 0;
+    }
+
+    size_t value_bytes(const translation_list& translations) {
+        return sizeof(translation_list) + translations.heap_bytes();
+    }
+
+    size_t value_bytes(const std::vector<std::string>& translations) {
+        size_t bytes = sizeof(std::vector<std::string>) + translations.capacity() * sizeof(std::string);
+        for (const std::string& translation : translations) bytes += string_heap_bytes(translation);
+        return bytes;
+    }
+
+    std::string benchmark_translation(size_t index) {
+        if (index == 0) return "слово";
+        return "перевод " + std::to_string(index);
+    }
+
+    void append_translation(translation_list& translations, const std::string& translation) {
+        translations.append(translation);
+    }
+
+    void append_translation(std::vector<std::string>& translations, const std::string& translation) {
+        translations.push_back(translation);
+    }
+
+    bool has_translation(const translation_list& translations, const std::string& translation) {
+        return translations.contains(translation);
+    }
+
+    bool has_translation(const std::vector<std::string>& translations, const std::string& translation) {
+        for (const std::string& current : translations) {
+            if (current == translation) return true;
+        }
+        return false;
+    }
+
+    template<typename value_type>
+    void run_value_benchmark(const char* name, const std::vector<std::string>& words) {
+        binary_tree<std::string, value_type> tree;
+        for (const std::string& word : words) tree.insert_helper(word, value_type());
+        double append_seconds = measure_seconds([&] {
+            for (size_t i = 0; i < words.size(); ++i) {
+                tree.modify_value(words[i], [i](value_type& translations) {
+                    for (size_t j = 0; j <= i % 3; ++j) append_translation(translations, benchmark_translation(j));
+                });
+            }
+        });
+        size_t bytes = 0;
+        tree.inorder_traverse([&bytes](const std::string&, const value_type& translations) {
+            bytes += value_bytes(translations);
+        });
+        size_t found = 0;
+        double lookup_seconds = measure_seconds([&] {
+            for (size_t i = 0; i < words.size(); ++i) {
+                if (has_translation(std::as_const(tree).get_value(words[i]), benchmark_translation(i % 3))) found++;
+            }
+        });
+        std::cout << "  " << name << ": значения " << bytes / words.size() << " байт/слово, добавление "
+                  << words.size() / append_seconds << " слов/с, поиск перевода "
+                  << words.size() / lookup_seconds << " слов/с (найдено " << found << ")\n";
+    }
+}
+
+void run_multi_benchmark() {
+    const size_t word_number = 300000;
+    std::vector<std::string> words;
+    for (size_t i = 0; i < word_number; ++i) words.push_back(benchmark_word(i));
+
+    std::cout << "[multi] " << word_number << " слов, от 1 до 3 переводов у слова\n";
+    run_value_benchmark<translation_list>("translation_list", words);
+    run_value_benchmark<std::vector<std::string>>("std::vector<std::string>", words);
+}
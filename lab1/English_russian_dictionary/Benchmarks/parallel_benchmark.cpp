@@ -0,0 +1,48 @@
+#include <iostream>
+#include <array>
+#include <thread>
+#include "benchmarks.h"
+#include "Dictionary.h"
+
+void run_parallel_benchmark() {
+    const size_t word_number = 2000000;
+
+    dictionary dict;
+    for (size_t i = 0; i < word_number; ++i) {
+        dict += std::make_pair(benchmark_word(i), i % 10 == 0 ? std::string() : std::string("перевод"));
+    }
+
+    struct word_statistics {
+        std::array<size_t, 256> first_letters{};
+        size_t empty_translations = 0;
+    };
+    auto accumulate = [](word_statistics& statistics, const std::string& english_word, const std::string& russian_word) {
+        statistics.first_letters[static_cast<unsigned char>(english_word[1])]++;
+        if (russian_word.empty()) statistics.empty_translations++;
+    };
+    auto combine = [](word_statistics left, const word_statistics& right) {
+        for (size_t i = 0; i < left.first_letters.size(); ++i) left.first_letters[i] += right.first_letters[i];
+        left.empty_translations += right.empty_translations;
+        return left;
+    };
+
+    word_statistics sequential;
+    double sequential_seconds = measure_seconds([&] {
+        dict.for_each_word([&](const std::string& english_word, const std::string& russian_word) {
+            accumulate(sequential, english_word, russian_word);
+        });
+    });
+    std::cout << "[parallel] " << word_number << " пар, ядер " << std::thread::hardware_concurrency() << "\n"
+              << "  for_each_word: " << sequential_seconds << " с\n";
+
+    for (size_t thread_number : {1, 2, 4, 8}) {
+        word_statistics parallel;
+        double seconds = measure_seconds([&] {
+            parallel = dict.parallel_reduce(word_statistics(), accumulate, combine, thread_number);
+        });
+        std::cout << "  parallel_reduce, потоков " << thread_number << ": " << seconds << " с, ускорение "
+                  << sequential_seconds / seconds
+                  << (parallel.empty_translations == sequential.empty_translations ? "" : " (результат не совпал)")
+                  << "\n";
+    }
+}
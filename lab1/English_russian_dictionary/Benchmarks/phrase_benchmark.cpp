@@ -0,0 +1,62 @@
+#include <iostream>
+#include <random>
+#include <vector>
+#include "benchmarks.h"
+#include "Phrase_matcher.h"
+
+void run_phrase_benchmark() {
+    const size_t vocabulary_size = 20000;
+    const size_t phrase_number = 10000;
+    const size_t corpus_words = 1000000;
+    const size_t longest_phrase_words = 4;
+
+    dictionary dict;
+    for (size_t i = 0; i < vocabulary_size; i += 2) dict += std::make_pair(benchmark_word(i), std::string("слово"));
+    for (size_t i = 0; i < phrase_number; ++i) {
+        std::string phrase = benchmark_word(i * 7 % vocabulary_size);
+        for (size_t word = 1; word <= 1 + i % (longest_phrase_words - 1); ++word) {
+            phrase += " " + benchmark_word((i * 13 + word * 101) % vocabulary_size);
+        }
+        if (!dict.contains_word(phrase)) dict += std::make_pair(phrase, std::string("фраза"));
+    }
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<size_t> word_distribution(0, vocabulary_size - 1);
+    std::string corpus;
+    for (size_t i = 0; i < corpus_words; ++i) {
+        corpus += benchmark_word(word_distribution(generator));
+        corpus += ' ';
+    }
+
+    phrase_matcher matcher;
+    double build_seconds = measure_seconds([&] { matcher.rebuild(dict); });
+
+    size_t automaton_matches = 0;
+    double automaton_seconds = measure_seconds([&] { automaton_matches = matcher.find_all(corpus).size(); });
+
+    size_t ngram_matches = 0;
+    double ngram_seconds = measure_seconds([&] {
+        std::vector<std::string> words;
+        size_t word_start = 0;
+        while (word_start < corpus.size()) {
+            size_t word_end = corpus.find(' ', word_start);
+            if (word_end == std::string::npos) word_end = corpus.size();
+            if (word_end > word_start) words.push_back(corpus.substr(word_start, word_end - word_start));
+            word_start = word_end + 1;
+        }
+        for (size_t i = 0; i < words.size(); ++i) {
+            std::string ngram;
+            for (size_t length = 0; length < longest_phrase_words && i + length < words.size(); ++length) {
+                if (length) ngram += ' ';
+                ngram += words[i + length];
+                if (dict.contains_word(ngram)) ngram_matches++;
+            }
+        }
+    });
+
+    double megabytes = corpus.size() / 1e6;
+    std::cout << "[phrase] словарь " << dict.get_size() << " ключей, текст " << megabytes << " МБ\n"
+              << "  построение автомата: " << build_seconds << " с, состояний " << matcher.get_state_number() << "\n"
+              << "  Ахо-Корасик: " << megabytes / automaton_seconds << " МБ/с, вхождений " << automaton_matches << "\n"
+              << "  перебор n-грамм: " << megabytes / ngram_seconds << " МБ/с, вхождений " << ngram_matches << "\n";
+}
@@ -0,0 +1,42 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <random>
+#include "benchmarks.h"
+#include "Sharded_dictionary.h"
+
+void run_sharded_benchmark() {
+    const size_t word_number = 100000;
+    const size_t operations_per_thread = 200000;
+
+    std::cout << "[sharded] " << word_number << " слов, " << operations_per_thread
+              << " операций на поток (20% изменений), ядер " << std::thread::hardware_concurrency() << "\n";
+    for (size_t shard_number : {size_t(1), size_t(16)}) {
+        for (size_t thread_number : {1, 2, 4, 8}) {
+            sharded_dictionary dict(shard_number);
+            for (size_t i = 0; i < word_number; ++i) dict += std::make_pair(benchmark_word(i), std::string("слово"));
+            std::vector<std::vector<std::string>> thread_words(thread_number);
+            for (size_t t = 0; t < thread_number; ++t) {
+                std::mt19937 generator(static_cast<unsigned>(t));
+                std::uniform_int_distribution<size_t> word_distribution(0, word_number - 1);
+                for (size_t i = 0; i < operations_per_thread; ++i) {
+                    thread_words[t].push_back(benchmark_word(word_distribution(generator)));
+                }
+            }
+            double seconds = measure_seconds([&] {
+                std::vector<std::thread> workers;
+                for (size_t t = 0; t < thread_number; ++t) {
+                    workers.emplace_back([&dict, &words = thread_words[t]]() {
+                        for (size_t i = 0; i < words.size(); ++i) {
+                            if (i % 5 == 0) dict.set_translation(words[i], "перевод");
+                            else dict.contains_word(words[i]);
+                        }
+                    });
+                }
+                for (std::thread& worker : workers) worker.join();
+            });
+            std::cout << "  частей " << shard_number << ", потоков " << thread_number << ": "
+                      << thread_number * operations_per_thread / seconds << " операций/с\n";
+        }
+    }
+}
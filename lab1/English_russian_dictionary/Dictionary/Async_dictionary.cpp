@@ -0,0 +1,109 @@
+#include "Async_dictionary.h"
+#include <fstream>
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include "String_validator.h"
+
+namespace {
+    const size_t progress_step = 1 << 16;
+}
+
+async_dictionary::async_dictionary(dictionary initial)
+        : published(std::make_shared<const dictionary>(std::move(initial))) {}
+
+async_dictionary::~async_dictionary() {
+    cancel_requested = true;
+    if (loader_thread.joinable()) loader_thread.join();
+}
+
+void async_dictionary::load_async(const std::string& file_name, progress_callback progress) {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    if (loading) throw std::runtime_error("Загрузка уже выполняется");
+    if (loader_thread.joinable()) loader_thread.join();
+    loading = true;
+    load_error = nullptr;
+    cancel_requested = false;
+    loaded_bytes = 0;
+    total_bytes = 0;
+    loader_thread = std::thread([this, file_name, progress = std::move(progress)]() {
+        load(file_name, progress);
+    });
+}
+
+void async_dictionary::load(const std::string& file_name, const progress_callback& progress) {
+    std::exception_ptr error;
+    try {
+        std::ifstream txt_file(file_name);
+        if (!txt_file.is_open()) throw std::runtime_error("Не удалось открыть файл " + file_name);
+        txt_file.seekg(0, std::ios::end);
+        size_t file_size = static_cast<size_t>(txt_file.tellg());
+        txt_file.seekg(0, std::ios::beg);
+        total_bytes = file_size;
+
+        dictionary staging(*snapshot());
+        size_t next_report = progress_step;
+        string_validator::read_word_pairs(txt_file, [&staging](const std::pair<std::string, std::string>& new_pair) {
+            if (!staging.contains_word(new_pair.first)) staging += new_pair;
+        }, [&](size_t line_bytes) {
+            loaded_bytes += line_bytes;
+            if (progress && loaded_bytes >= next_report) {
+                progress(loaded_bytes, file_size);
+                next_report = loaded_bytes + progress_step;
+            }
+            return !cancel_requested;
+        });
+        if (!cancel_requested) {
+            loaded_bytes = file_size;
+            if (progress) progress(file_size, file_size);
+            std::atomic_store(&published, std::shared_ptr<const dictionary>(
+                    std::make_shared<const dictionary>(std::move(staging))));
+        }
+    } catch (...) {
+        error = std::current_exception();
+    }
+    {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        loading = false;
+        load_error = error;
+    }
+    ready_condition.notify_all();
+}
+
+std::shared_ptr<const dictionary> async_dictionary::snapshot() const {
+    return std::atomic_load(&published);
+}
+
+std::shared_ptr<const dictionary> async_dictionary::wait_ready() {
+    std::unique_lock<std::mutex> lock(state_mutex);
+    ready_condition.wait(lock, [this] { return !loading; });
+    if (load_error) {
+        std::exception_ptr error = load_error;
+        load_error = nullptr;
+        std::rethrow_exception(error);
+    }
+    return snapshot();
+}
+
+bool async_dictionary::is_ready() const {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    return !loading;
+}
+
+double async_dictionary::get_progress() const {
+    size_t total = total_bytes;
+    if (total == 0) return is_ready() ? 1.0 : 0.0;
+    return std::min(1.0, static_cast<double>(loaded_bytes) / static_cast<double>(total));
+}
+
+bool async_dictionary::contains_word(const std::string& english_word) const {
+    return snapshot()->contains_word(english_word);
+}
+
+std::string async_dictionary::operator[](const std::string& english_word) const {
+    return (*snapshot())[english_word];
+}
+
+int async_dictionary::get_size() const {
+    return snapshot()->get_size();
+}
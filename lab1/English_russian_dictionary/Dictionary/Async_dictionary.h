@@ -0,0 +1,130 @@
+/**
+ * @file Async_dictionary.h
+ * @author Ященко Александра
+ * @brief Заголовочный файл словаря с фоновой загрузкой из файла.
+ */
+
+#ifndef SEM3_L1_PPOIS_ASYNC_DICTIONARY_H
+#define SEM3_L1_PPOIS_ASYNC_DICTIONARY_H
+
+#include <string>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include "Dictionary.h"
+
+/**
+ * @class async_dictionary
+ * @brief Словарь, новая версия которого загружается из файла в фоновом потоке.
+ * @details Текущая версия хранится в std::shared_ptr<const dictionary> и заменяется
+ * атомарно (std::atomic_load/std::atomic_store). Загрузка копирует текущую версию
+ * во временный словарь, добавляет в него слова из файла по правилам
+ * dictionary::read_from_file и публикует результат одной операцией.
+ *
+ * Пока идет загрузка, поиск обслуживается предыдущей версией без ожидания.
+ * Если нужны слова из файла, следует вызвать wait_ready. Полученная через snapshot
+ * версия не меняется, даже если после этого опубликована новая.
+ *
+ * @see dictionary
+ */
+class async_dictionary {
+public:
+    /**
+     * @brief Функция хода загрузки вида void(size_t loaded_bytes, size_t total_bytes).
+     * @details Вызывается из фонового потока примерно через каждые 64 КБ файла и в конце загрузки.
+     */
+    using progress_callback = std::function<void(size_t, size_t)>;
+
+private:
+    std::shared_ptr<const dictionary> published; ///< Опубликованная версия, доступ только атомарный
+    std::thread loader_thread; ///< Поток текущей или последней загрузки
+    mutable std::mutex state_mutex; ///< Защищает loading и load_error
+    std::condition_variable ready_condition; ///< Сигнал окончания загрузки
+    bool loading = false; ///< Идет ли загрузка
+    std::exception_ptr load_error; ///< Ошибка последней загрузки, еще не переданная wait_ready
+    std::atomic<bool> cancel_requested{false}; ///< Запрошена ли отмена загрузки
+    std::atomic<size_t> loaded_bytes{0}; ///< Прочитано байт файла
+    std::atomic<size_t> total_bytes{0}; ///< Размер загружаемого файла
+
+    /**
+     * @brief Тело фонового потока.
+     * @param file_name Имя файла.
+     * @param progress Функция хода загрузки.
+     */
+    void load(const std::string& file_name, const progress_callback& progress);
+
+public:
+    /**
+     * @brief Конструктор.
+     * @param initial Начальная версия словаря.
+     */
+    explicit async_dictionary(dictionary initial = dictionary());
+
+    /**
+     * @brief Деструктор. Отменяет загрузку и ждет завершения потока.
+     */
+    ~async_dictionary();
+
+    async_dictionary(const async_dictionary&) = delete;
+    async_dictionary& operator=(const async_dictionary&) = delete;
+
+    /**
+     * @brief Запуск загрузки файла в фоновом потоке.
+     * @param file_name Имя файла в формате dictionary::read_from_file.
+     * @param progress Функция хода загрузки, может быть пустой.
+     * @throw std::runtime_error если предыдущая загрузка еще не закончилась.
+     */
+    void load_async(const std::string& file_name, progress_callback progress = progress_callback());
+
+    /**
+     * @brief Получение текущей опубликованной версии.
+     * @return Неизменяемая версия словаря, действительная, пока жив указатель.
+     */
+    std::shared_ptr<const dictionary> snapshot() const;
+
+    /**
+     * @brief Ожидание окончания загрузки.
+     * @return Версия словаря после загрузки.
+     * @throw std::runtime_error если файл не удалось открыть; ошибка передается один раз.
+     */
+    std::shared_ptr<const dictionary> wait_ready();
+
+    /**
+     * @brief Проверка, закончена ли загрузка.
+     * @return true если загрузка не выполняется.
+     */
+    bool is_ready() const;
+
+    /**
+     * @brief Получение доли прочитанного файла.
+     * @return Число от 0 до 1; 1 если загрузка не выполнялась.
+     */
+    double get_progress() const;
+
+    /**
+     * @brief Проверяет наличие слова в текущей версии.
+     * @param english_word Английское слово.
+     * @return true если слово найдено.
+     */
+    bool contains_word(const std::string& english_word) const;
+
+    /**
+     * @brief Получение перевода слова из текущей версии.
+     * @param english_word Английское слово.
+     * @return Копия перевода.
+     * @throw std::out_of_range если слова нет в словаре.
+     */
+    std::string operator[](const std::string& english_word) const;
+
+    /**
+     * @brief Получение количества слов в текущей версии.
+     * @return Количество пар слово-перевод.
+     */
+    int get_size() const;
+};
+
+#endif //SEM3_L1_PPOIS_ASYNC_DICTIONARY_H
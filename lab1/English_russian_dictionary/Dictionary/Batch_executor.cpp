@@ -0,0 +1,110 @@
+#include "Batch_executor.h"
+#include <fstream>
+#include <chrono>
+#include <stdexcept>
+#include "String_validator.h"
+
+namespace {
+    const size_t output_flush_threshold = 1 << 16;
+    const size_t stored_error_limit = 20;
+
+    std::pair<std::string, std::string> parse_translation_pair(const std::string& argument) {
+        std::pair<std::string, std::string> english_russian_pair = string_validator::word_pair_input(argument);
+        if (english_russian_pair.second.empty()) throw std::invalid_argument("Перевод введен неверно");
+        return english_russian_pair;
+    }
+
+    std::string parse_english_word(const std::string& argument) {
+        std::string english_word = string_validator::normalize_phrase(argument);
+        if (!string_validator::valid_english_phrase(english_word)) throw std::invalid_argument("Слово введено неверно");
+        return english_word;
+    }
+}
+
+std::ostream& operator<<(std::ostream& output, const batch_report& report) {
+    output << "Выполнено команд: " << report.command_number << ", ошибок: " << report.error_number
+           << ", время: " << report.seconds << " с";
+    if (report.seconds > 0) output << ", " << static_cast<size_t>(report.command_number / report.seconds) << " команд/с";
+    output << "\n";
+    for (const std::string& error : report.errors) output << "  " << error << "\n";
+    if (report.error_number > report.errors.size()) {
+        output << "  ... еще " << report.error_number - report.errors.size() << " ошибок\n";
+    }
+    return output;
+}
+
+batch_executor::batch_executor(dictionary& dictionary_, std::ostream& output_)
+        : target_dictionary(dictionary_), output(output_) {}
+
+void batch_executor::flush_output(bool force) {
+    if (output_buffer.empty() || (!force && output_buffer.size() < output_flush_threshold)) return;
+    output.write(output_buffer.data(), static_cast<std::streamsize>(output_buffer.size()));
+    output_buffer.clear();
+}
+
+void batch_executor::execute_command(const std::string& command, const std::string& argument) {
+    if (command == "add") {
+        target_dictionary += parse_translation_pair(argument);
+    } else if (command == "del") {
+        target_dictionary -= parse_english_word(argument);
+    } else if (command == "get") {
+        std::string english_word = parse_english_word(argument);
+        const dictionary& lookup_dictionary = target_dictionary;
+        const std::string& russian_word = lookup_dictionary[english_word];
+        output_buffer += english_word;
+        output_buffer += " - ";
+        output_buffer += russian_word;
+        output_buffer += '\n';
+    } else if (command == "set") {
+        std::pair<std::string, std::string> english_russian_pair = parse_translation_pair(argument);
+        target_dictionary.set_translation(english_russian_pair.first, english_russian_pair.second);
+    } else if (command == "load") {
+        if (!std::ifstream(argument).is_open()) throw std::runtime_error("Не удалось открыть файл " + argument);
+        target_dictionary.read_from_file(argument);
+    } else if (command == "dump") {
+        if (argument.empty()) {
+            target_dictionary.for_each_word([this](const std::string& english_word, const std::string& russian_word) {
+                output_buffer += english_word;
+                output_buffer += " - ";
+                output_buffer += russian_word;
+                output_buffer += '\n';
+                flush_output();
+            });
+        } else if (!target_dictionary.write_to_file(argument)) {
+            throw std::runtime_error("Не удалось записать файл " + argument);
+        }
+    } else {
+        throw std::invalid_argument("Неизвестная команда " + command);
+    }
+    flush_output();
+}
+
+batch_report batch_executor::execute(std::istream& commands) {
+    batch_report report;
+    auto start = std::chrono::steady_clock::now();
+    std::string current_line;
+    size_t line_number = 0;
+    while (std::getline(commands, current_line)) {
+        line_number++;
+        string_validator::remove_spaces(current_line);
+        if (current_line.empty() || current_line[0] == '#') continue;
+        size_t command_end = current_line.find_first_of(" \t");
+        std::string command = current_line.substr(0, command_end);
+        std::string argument = command_end == std::string::npos ? "" : current_line.substr(command_end + 1);
+        string_validator::remove_spaces(argument);
+        report.command_number++;
+        try {
+            execute_command(command, argument);
+        } catch (const std::exception& exception) {
+            report.error_number++;
+            if (report.errors.size() < stored_error_limit) {
+                report.errors.push_back("строка " + std::to_string(line_number) + ": " + exception.what());
+            }
+        }
+    }
+    flush_output(true);
+    output.flush();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    report.seconds = elapsed.count();
+    return report;
+}
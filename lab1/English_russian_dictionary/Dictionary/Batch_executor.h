@@ -0,0 +1,88 @@
+/**
+ * @file Batch_executor.h
+ * @author Ященко Александра
+ * @brief Заголовочный файл пакетного выполнения команд над словарем.
+ */
+
+#ifndef SEM3_L1_PPOIS_BATCH_EXECUTOR_H
+#define SEM3_L1_PPOIS_BATCH_EXECUTOR_H
+
+#include <string>
+#include <vector>
+#include <istream>
+#include <ostream>
+#include "Dictionary.h"
+
+/**
+ * @struct batch_report
+ * @brief Итог выполнения пакета команд
+ */
+struct batch_report {
+    size_t command_number = 0; ///< Количество выполненных команд, включая ошибочные
+    size_t error_number = 0; ///< Количество команд, завершившихся ошибкой
+    double seconds = 0; ///< Время выполнения в секундах
+    std::vector<std::string> errors; ///< Описания первых ошибок с номерами строк
+};
+
+/**
+ * @brief Вывод итога выполнения пакета
+ * @param[out] output Выходной поток
+ * @param[in] report Итог выполнения
+ * @return Ссылка на выходной поток
+ */
+std::ostream& operator<<(std::ostream& output, const batch_report& report);
+
+/**
+ * @class batch_executor
+ * @brief Выполняет команды из потока над словарем без диалога с пользователем.
+ * @details Каждая строка содержит одну команду:
+ * - add слово - перевод: добавить пару (формат как в read_from_file);
+ * - del слово: удалить слово;
+ * - get слово: вывести "слово - перевод";
+ * - set слово - перевод: изменить перевод;
+ * - load файл: добавить слова из файла;
+ * - dump [файл]: записать словарь в файл или вывести его, если файл не указан.
+ *
+ * Пустые строки и строки, начинающиеся с '#', пропускаются. Ошибочная команда
+ * не прерывает выполнение, а учитывается в batch_report. Вывод накапливается
+ * в буфере и передается в поток крупными блоками.
+ *
+ * @see dictionary
+ */
+class batch_executor {
+private:
+    dictionary& target_dictionary; ///< Словарь, над которым выполняются команды
+    std::ostream& output; ///< Поток для результатов get и dump
+    std::string output_buffer; ///< Накопленный, но еще не записанный вывод
+
+    /**
+     * @brief Выполняет одну команду.
+     * @param command Имя команды.
+     * @param argument Остаток строки после имени команды.
+     * @throw std::invalid_argument, std::out_of_range или std::runtime_error при ошибке.
+     */
+    void execute_command(const std::string& command, const std::string& argument);
+
+    /**
+     * @brief Передает буфер в поток, если он стал больше порога.
+     * @param force Передать буфер независимо от его размера.
+     */
+    void flush_output(bool force = false);
+
+public:
+    /**
+     * @brief Конструктор.
+     * @param dictionary_ Словарь, над которым выполняются команды.
+     * @param output_ Поток для результатов команд.
+     */
+    batch_executor(dictionary& dictionary_, std::ostream& output_);
+
+    /**
+     * @brief Выполняет все команды из потока.
+     * @param commands Поток команд, по одной на строку.
+     * @return Итог выполнения.
+     */
+    batch_report execute(std::istream& commands);
+};
+
+#endif //SEM3_L1_PPOIS_BATCH_EXECUTOR_H
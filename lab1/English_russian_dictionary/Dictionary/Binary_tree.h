@@ -11,6 +11,26 @@
 #include <string>
 #include <algorithm>
 #include <stdexcept>
+#include <ostream>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <utility>
+
+/**
+ * @brief Проверяет, можно ли хешировать тип через std::hash.
+ * @tparam type Проверяемый тип.
+ */
+template<typename type, typename = void>
+struct is_hashable : std::false_type {};
+
+template<typename type>
+struct is_hashable<type, std::void_t<decltype(std::hash<type>{}(std::declval<const type&>()))>>
+        : std::true_type {};
 
 /**
  * @class binary_tree
@@ -38,6 +58,8 @@ private:
         tree_node* left_child; ///< Указатель на левого потомка
         tree_node* right_child; ///< Указатель на правого потомка
         int node_height; ///< Высота поддерева с корнем в этом узле(высота поддерева)
+        bool value_exposed; ///< Выдавалась ли изменяемая ссылка на значение через get_value
+        size_t exposed_slot; ///< Позиция узла в exposed_nodes, если value_exposed
         /**
          * @brief Конструктор с заданными ключом и значением.
          * @param key_t_ Ключ узла.
@@ -45,19 +67,94 @@ private:
          */
         tree_node(const key_type& key_t_, const value_type& value_t_)
                 : key_t(key_t_), value_t(value_t_),
-                  left_child(nullptr), right_child(nullptr), node_height(1) {}
-
-        /**
-         * @brief Копирует ключ и значение.
-         * @param other Узел, на основе которого инициализируются поля текущего узла.
-         */
-        void copy_data(const tree_node* other) {
-            key_t = other->key_t;
-            value_t = other->value_t;
-        }
+                  left_child(nullptr), right_child(nullptr), node_height(1), value_exposed(false), exposed_slot(0) {}
     };
 
     tree_node* tree_root; ///< Корень дерева
+    size_t node_count; ///< Количество узлов
+    uint64_t content_fingerprint; ///< Сумма хешей всех пар ключ-значение
+    std::vector<tree_node*> exposed_nodes; ///< Узлы с выданными изменяемыми ссылками, не учтенные в content_fingerprint
+
+    /**
+     * @brief Перемешивает биты 64-битного числа (финализатор splitmix64).
+     * @param value Исходное число.
+     * @return Перемешанное число.
+     */
+    static uint64_t mix_bits(uint64_t value) {
+        value += 0x9e3779b97f4a7c15ULL;
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+        return value ^ (value >> 31);
+    }
+
+    /**
+     * @brief Вычисляет хеш одной пары ключ-значение.
+     * @param key_ Ключ.
+     * @param value_ Значение.
+     * @return Хеш пары или 0, если ключ или значение не поддерживают std::hash.
+     */
+    static uint64_t entry_hash(const key_type& key_, const value_type& value_) {
+        if constexpr (is_hashable<key_type>::value && is_hashable<value_type>::value) {
+            return mix_bits(mix_bits(std::hash<key_type>{}(key_)) ^ std::hash<value_type>{}(value_));
+        } else {
+            return 0;
+        }
+    }
+
+    /**
+     * @brief Учитывает в отпечатке и количестве узлов узел, добавленный в дерево.
+     * @param node Узел.
+     * @details Значение узла, на которое выдавалась изменяемая ссылка, может измениться
+     *          в любой момент, поэтому такой узел не входит в content_fingerprint, а
+     *          хешируется заново при каждом вызове get_fingerprint.
+     */
+    void remember_entry(tree_node* node) {
+        node_count++;
+        if (node->value_exposed) add_exposed(node);
+        else content_fingerprint += entry_hash(node->key_t, node->value_t);
+    }
+
+    /**
+     * @brief Убирает из отпечатка и количества узлов узел, который удаляется или переносится в другое дерево.
+     * @param node Узел.
+     * @see remember_entry
+     */
+    void forget_entry(tree_node* node) {
+        node_count--;
+        if (node->value_exposed) remove_exposed(node);
+        else content_fingerprint -= entry_hash(node->key_t, node->value_t);
+    }
+
+    /**
+     * @brief Добавляет узел в конец exposed_nodes и запоминает его позицию.
+     * @param node Узел с выданной ссылкой на значение.
+     */
+    void add_exposed(tree_node* node) {
+        node->exposed_slot = exposed_nodes.size();
+        exposed_nodes.push_back(node);
+    }
+
+    /**
+     * @brief Убирает узел из exposed_nodes за O(1), ставя на его место последний узел.
+     * @param node Узел из exposed_nodes.
+     */
+    void remove_exposed(tree_node* node) {
+        tree_node* last_node = exposed_nodes.back();
+        exposed_nodes[node->exposed_slot] = last_node;
+        last_node->exposed_slot = node->exposed_slot;
+        exposed_nodes.pop_back();
+    }
+
+    /**
+     * @brief Пересчитывает content_fingerprint обходом всех узлов за O(n).
+     */
+    void recompute_fingerprint() {
+        content_fingerprint = 0;
+        inorder_traverse([this](const key_type& key_, const value_type& value_) {
+            content_fingerprint += entry_hash(key_, value_);
+        });
+        for (const tree_node* node : exposed_nodes) content_fingerprint -= entry_hash(node->key_t, node->value_t);
+    }
 
     /**
      * @brief Получение высоты поддерева.
@@ -156,21 +253,157 @@ private:
     }
 
     /**
-     * @brief Проверяет равенство двух деревьев.
+     * @brief Проверяет равенство содержимого двух деревьев.
      * @param tree_node1 Корень первого дерева.
      * @param tree_node2 Корень второго дерева.
-     * @return True, если деревья равны, и false в обратном случае.
+     * @details Деревья обходятся в порядке возрастания ключей одновременно, поэтому
+     *          деревья с одинаковым содержимым, но разной формой, считаются равными.
+     * @return True, если деревья содержат одинаковые пары ключ-значение, и false в обратном случае.
      */
     bool are_trees_equal(const tree_node* tree_node1, const tree_node* tree_node2) const {
-        if (tree_node1 == nullptr && tree_node2 == nullptr) return true;
-        if (tree_node1 == nullptr || tree_node2 == nullptr) return false;
+        inorder_iterator first(tree_node1);
+        inorder_iterator second(tree_node2);
+        while (!first.is_end() && !second.is_end()) {
+            if (first.key() != second.key() || first.value() != second.value()) return false;
+            ++first;
+            ++second;
+        }
+        return first.is_end() && second.is_end();
+    }
+
+    /**
+     * @brief Соединяет два дерева и узел-разделитель в одно сбалансированное дерево.
+     * @param left_tree Дерево с ключами меньше ключа разделителя.
+     * @param pivot_node Узел-разделитель.
+     * @param right_tree Дерево с ключами больше ключа разделителя.
+     * @details Спускается по более высокому дереву до поддерева сопоставимой высоты и
+     *          восстанавливает баланс на обратном пути. Время O(|h(left_tree) - h(right_tree)| + 1).
+     * @return Корень полученного дерева.
+     */
+    tree_node* join_trees(tree_node* left_tree, tree_node* pivot_node, tree_node* right_tree) {
+        if (get_height(left_tree) > get_height(right_tree) + 1) {
+            left_tree->right_child = join_trees(left_tree->right_child, pivot_node, right_tree);
+            return balance(left_tree);
+        }
+        if (get_height(right_tree) > get_height(left_tree) + 1) {
+            right_tree->left_child = join_trees(left_tree, pivot_node, right_tree->left_child);
+            return balance(right_tree);
+        }
+        pivot_node->left_child = left_tree;
+        pivot_node->right_child = right_tree;
+        update_height(pivot_node);
+        return pivot_node;
+    }
+
+    /**
+     * @brief Разделяет дерево по ключу.
+     * @param current Корень разделяемого дерева.
+     * @param split_key Ключ разделения.
+     * @param left_tree Дерево с ключами меньше split_key.
+     * @param found_node Узел с ключом split_key (отсоединенный) или nullptr.
+     * @param right_tree Дерево с ключами больше split_key.
+     * @details Узлы исходного дерева переиспользуются, время O(log n).
+     */
+    void split_tree(tree_node* current, const key_type& split_key,
+                    tree_node*& left_tree, tree_node*& found_node, tree_node*& right_tree) {
+        if (!current) {
+            left_tree = right_tree = found_node = nullptr;
+            return;
+        }
+        tree_node* left_child = current->left_child;
+        tree_node* right_child = current->right_child;
+        if (split_key < current->key_t) {
+            tree_node* middle_tree;
+            split_tree(left_child, split_key, left_tree, found_node, middle_tree);
+            right_tree = join_trees(middle_tree, current, right_child);
+        } else if (current->key_t < split_key) {
+            tree_node* middle_tree;
+            split_tree(right_child, split_key, middle_tree, found_node, right_tree);
+            left_tree = join_trees(left_child, current, middle_tree);
+        } else {
+            left_tree = left_child;
+            right_tree = right_child;
+            current->left_child = current->right_child = nullptr;
+            current->node_height = 1;
+            found_node = current;
+        }
+    }
 
-        if (tree_node1->key_t != tree_node2->key_t || tree_node1->value_t != tree_node2->value_t) {
-            return false;
+    template<typename resolver>
+    /**
+     * @brief Объединяет два дерева, переиспользуя их узлы.
+     * @param own_tree Корень первого дерева.
+     * @param other_tree Корень второго дерева.
+     * @param resolver_ Функция вида value_type(const key_type&, const value_type& own, const value_type& other),
+     *                  выбирающая значение для ключа, который есть в обоих деревьях.
+     * @details Делит первое дерево по корню второго, рекурсивно объединяет половины и соединяет
+     *          результаты через join_trees. Время O(m log(n/m + 1)), где m <= n - размеры деревьев.
+     * @return Корень объединенного дерева.
+     */
+    tree_node* union_trees(tree_node* own_tree, tree_node* other_tree, resolver& resolver_) {
+        if (!own_tree) return other_tree;
+        if (!other_tree) return own_tree;
+        tree_node *left_tree, *found_node, *right_tree;
+        split_tree(own_tree, other_tree->key_t, left_tree, found_node, right_tree);
+        tree_node* other_left = other_tree->left_child;
+        tree_node* other_right = other_tree->right_child;
+        if (found_node) {
+            forget_entry(found_node);
+            content_fingerprint -= entry_hash(other_tree->key_t, other_tree->value_t);
+            other_tree->value_t = resolver_(other_tree->key_t, found_node->value_t, other_tree->value_t);
+            content_fingerprint += entry_hash(other_tree->key_t, other_tree->value_t);
+            delete found_node;
         }
+        tree_node* joined_left = union_trees(left_tree, other_left, resolver_);
+        tree_node* joined_right = union_trees(right_tree, other_right, resolver_);
+        return join_trees(joined_left, other_tree, joined_right);
+    }
 
-        return are_trees_equal(tree_node1->left_child, tree_node2->left_child) &&
-               are_trees_equal(tree_node1->right_child, tree_node2->right_child);
+    /**
+     * @brief Отсоединяет узел с наименьшим ключом.
+     * @param current Корень дерева.
+     * @param min_node Отсоединенный узел.
+     * @return Корень дерева без этого узла.
+     */
+    tree_node* detach_min(tree_node* current, tree_node*& min_node) {
+        if (!current->left_child) {
+            min_node = current;
+            tree_node* right_child = current->right_child;
+            current->right_child = nullptr;
+            current->node_height = 1;
+            return right_child;
+        }
+        current->left_child = detach_min(current->left_child, min_node);
+        update_height(current);
+        return balance(current);
+    }
+
+    /**
+     * @brief Соединяет два дерева без узла-разделителя.
+     * @param left_tree Дерево с меньшими ключами.
+     * @param right_tree Дерево с большими ключами.
+     * @return Корень полученного дерева.
+     */
+    tree_node* join_two_trees(tree_node* left_tree, tree_node* right_tree) {
+        if (!right_tree) return left_tree;
+        tree_node* pivot_node;
+        right_tree = detach_min(right_tree, pivot_node);
+        return join_trees(left_tree, pivot_node, right_tree);
+    }
+
+    /**
+     * @brief Вставляет в дерево уже созданный узел.
+     * @param current Текущий корень.
+     * @param new_node Отсоединенный узел, ключа которого нет в дереве.
+     * @return Корень поддерева.
+     * @details В отличие от insert_node, память не выделяется.
+     */
+    tree_node* insert_existing_node(tree_node* current, tree_node* new_node) {
+        if (!current) return new_node;
+        if (new_node->key_t < current->key_t) current->left_child = insert_existing_node(current->left_child, new_node);
+        else current->right_child = insert_existing_node(current->right_child, new_node);
+        update_height(current);
+        return balance(current);
     }
 
     /**
@@ -213,12 +446,8 @@ private:
      */
     tree_node* delete_simple_node(tree_node* current) {
         tree_node *temporary = current->left_child ? current->left_child : current->right_child;
-        if (!temporary) {
-            temporary = current;
-            current = nullptr;
-        } else *current = *temporary;
-        delete temporary;
-        return current;
+        delete current;
+        return temporary;
     }
 
     /**
@@ -227,6 +456,8 @@ private:
      * @param input_key Ключ удаляемого узла.
      * @details Рекурсивно находит узел с заданным ключом, удаляет его согласно правилам BST,
      *          затем обновляет высоты и выполняет балансировку для сохранения свойств AVL-дерева.
+     *          Узел с двумя потомками заменяется своим преемником: узлы переставляются,
+     *          а ключи и значения остальных узлов не копируются.
      * @return Указатель на текущий корень.
      * @see delete_helper
      * @see delete_simple_node
@@ -239,12 +470,12 @@ private:
             if (!current->left_child || !current->right_child) {
                 current = delete_simple_node(current);
             } else {
-                tree_node *temporary = current->right_child;
-                while (temporary->left_child) {
-                    temporary = temporary->left_child;
-                }
-                current->copy_data(temporary);
-                current->right_child = delete_node(current->right_child, temporary->key_t);
+                tree_node *temporary;
+                tree_node *right_tree = detach_min(current->right_child, temporary);
+                temporary->left_child = current->left_child;
+                temporary->right_child = right_tree;
+                delete current;
+                current = temporary;
             }
         }
         update_height(current);
@@ -272,37 +503,28 @@ private:
             clear_helper(tree_root);
             tree_root=nullptr;
         }
-    }
-
-    /**
-     * @brief Считает все узлы в дереве.
-     * @param current Текущий корень.
-     * @param counter Счетчик узлов.
-     * @return Количество узлов в дереве.
-     * @see get_size
-     */
-    int tree_size(tree_node* current, int& counter) const {
-        if (current) {
-            counter++;
-            if (current->left_child || current->right_child) {
-                counter = tree_size(current->left_child, counter);
-                counter = tree_size(current->right_child, counter);
-            }
-        }
-        return counter;
+        node_count = 0;
+        content_fingerprint = 0;
+        exposed_nodes.clear();
     }
 
     /**
      * @brief Копирует дерево.
      * @param current Корень исходного дерева для копирования.
      * @return Указатель на корень нового дерева.
+     * @details Если копирование узла бросает исключение, уже созданные узлы удаляются.
      */
     tree_node* copy_tree(const tree_node* current) {
         if (!current) return nullptr;
         tree_node *new_node = new tree_node(current->key_t, current->value_t);
         new_node->node_height = current->node_height;
-        new_node->left_child = copy_tree(current->left_child);
-        new_node->right_child = copy_tree(current->right_child);
+        try {
+            new_node->left_child = copy_tree(current->left_child);
+            new_node->right_child = copy_tree(current->right_child);
+        } catch (...) {
+            clear_helper(new_node);
+            throw;
+        }
         return new_node;
     }
 
@@ -321,12 +543,241 @@ private:
         inorder_traverse_helper(current->right_child, function_);
     }
 
+    /**
+     * @struct traversal_segment
+     * @brief Часть дерева для параллельного обхода: поддерево и следующий за ним узел.
+     */
+    struct traversal_segment {
+        tree_node* subtree; ///< Поддерево, обходимое целиком (может быть nullptr)
+        tree_node* suffix_node; ///< Узел, обрабатываемый после поддерева (может быть nullptr)
+    };
+
+    /**
+     * @brief Делит дерево на части, идущие в порядке возрастания ключей.
+     * @param current Корень делимого поддерева.
+     * @param depth Сколько уровней еще нужно разделить.
+     * @param segments Вектор, в конец которого добавляются части.
+     * @details Поддеревья на глубине depth становятся отдельными частями, а узлы выше
+     * присоединяются к предыдущей части. Так как дерево сбалансировано, части
+     * одного уровня отличаются по размеру не более чем в несколько раз.
+     */
+    static void split_segments(tree_node* current, int depth, std::vector<traversal_segment>& segments) {
+        if (!current) return;
+        if (depth == 0) {
+            segments.push_back({current, nullptr});
+            return;
+        }
+        size_t segment_number = segments.size();
+        split_segments(current->left_child, depth - 1, segments);
+        if (segments.size() > segment_number && !segments.back().suffix_node) segments.back().suffix_node = current;
+        else segments.push_back({nullptr, current});
+        split_segments(current->right_child, depth - 1, segments);
+    }
+
+    /**
+     * @brief Выполняет обработку частей в нескольких потоках.
+     * @tparam function Тип функции вида void(size_t номер_части).
+     * @param segment_number Количество частей.
+     * @param thread_number Количество потоков, включая вызывающий.
+     * @param process_segment Функция обработки части.
+     * @details Потоки берут части из общей очереди по атомарному счетчику. Первое
+     * исключение, выброшенное обработкой, передается вызывающему после завершения потоков.
+     */
+    template<typename function>
+    static void run_segments(size_t segment_number, size_t thread_number, function& process_segment) {
+        std::atomic<size_t> next_segment(0);
+        std::exception_ptr first_exception;
+        std::atomic<bool> has_exception(false);
+        auto worker = [&]() {
+            for (size_t index = next_segment++; index < segment_number; index = next_segment++) {
+                try {
+                    process_segment(index);
+                } catch (...) {
+                    if (!has_exception.exchange(true)) first_exception = std::current_exception();
+                }
+            }
+        };
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < std::min(thread_number, segment_number); ++i) workers.emplace_back(worker);
+        worker();
+        for (std::thread& current_thread : workers) current_thread.join();
+        if (first_exception) std::rethrow_exception(first_exception);
+    }
+
+    /**
+     * @brief Делит дерево на части для заданного числа потоков.
+     * @param thread_number Количество потоков, 0 - по числу ядер.
+     * @return Пара: части в порядке возрастания ключей и итоговое количество потоков.
+     */
+    std::pair<std::vector<traversal_segment>, size_t> prepare_segments(size_t thread_number) const {
+        if (thread_number == 0) thread_number = std::max(1u, std::thread::hardware_concurrency());
+        int depth = 0;
+        while ((size_t(1) << depth) < thread_number * 8 && depth < get_height(tree_root) - 1) depth++;
+        std::vector<traversal_segment> segments;
+        split_segments(tree_root, thread_number == 1 ? 0 : depth, segments);
+        return {std::move(segments), thread_number};
+    }
+
 public:
 
+    /**
+     * @class node_handle
+     * @brief Владеет узлом, извлеченным из дерева.
+     * @details Позволяет перенести узел в другое дерево через insert без выделения
+     *          памяти и копирования ключа и значения. Если узел так и не вставлен,
+     *          он удаляется вместе с node_handle.
+     * @see extract
+     * @see insert
+     */
+    class node_handle {
+    private:
+        friend class binary_tree;
+        tree_node* owned_node; ///< Извлеченный узел или nullptr
+
+        /**
+         * @brief Конструктор из отсоединенного узла.
+         * @param node_ Узел.
+         */
+        explicit node_handle(tree_node* node_) : owned_node(node_) {}
+
+    public:
+        /**
+         * @brief Конструктор пустого node_handle.
+         */
+        node_handle() : owned_node(nullptr) {}
+
+        /**
+         * @brief Конструктор перемещения.
+         * @param other Исходный node_handle, становится пустым.
+         */
+        node_handle(node_handle&& other) noexcept : owned_node(other.owned_node) {
+            other.owned_node = nullptr;
+        }
+
+        /**
+         * @brief Оператор присваивания с перемещением.
+         * @param other Исходный node_handle, становится пустым.
+         * @return Ссылка на текущий объект.
+         */
+        node_handle& operator=(node_handle&& other) noexcept {
+            if (this != &other) {
+                delete owned_node;
+                owned_node = other.owned_node;
+                other.owned_node = nullptr;
+            }
+            return *this;
+        }
+
+        node_handle(const node_handle&) = delete;
+        node_handle& operator=(const node_handle&) = delete;
+
+        /**
+         * @brief Деструктор. Удаляет узел, если он не был вставлен в дерево.
+         */
+        ~node_handle() {
+            delete owned_node;
+        }
+
+        /**
+         * @brief Проверяет, владеет ли объект узлом.
+         * @return true если узла нет.
+         */
+        bool empty() const {
+            return !owned_node;
+        }
+
+        /**
+         * @brief Получает ключ узла.
+         * @return Ключ.
+         * @throw std::out_of_range если node_handle пуст.
+         */
+        const key_type& key() const {
+            if (!owned_node) throw std::out_of_range("Узел пуст.");
+            return owned_node->key_t;
+        }
+
+        /**
+         * @brief Получает значение узла для чтения или изменения.
+         * @return Значение.
+         * @throw std::out_of_range если node_handle пуст.
+         */
+        value_type& value() const {
+            if (!owned_node) throw std::out_of_range("Узел пуст.");
+            return owned_node->value_t;
+        }
+    };
+
+    /**
+     * @class inorder_iterator
+     * @brief Итератор для обхода дерева в порядке возрастания ключей.
+     * @details Хранит путь от корня до текущего узла в явном стеке, поэтому переход
+     *          к следующему узлу выполняется за амортизированное O(1) без рекурсии.
+     *          Итератор становится недействительным после изменения дерева.
+     */
+    class inorder_iterator {
+    private:
+        std::vector<const tree_node*> node_stack; ///< Путь к текущему узлу
+
+        /**
+         * @brief Добавляет в стек узел и всю цепочку его левых потомков.
+         * @param current Узел, с которого начинается спуск.
+         */
+        void push_left_path(const tree_node* current) {
+            while (current) {
+                node_stack.push_back(current);
+                current = current->left_child;
+            }
+        }
+
+    public:
+        /**
+         * @brief Конструктор. Устанавливает итератор на наименьший ключ поддерева.
+         * @param tree_root_ Корень обходимого поддерева.
+         */
+        explicit inorder_iterator(const tree_node* tree_root_) {
+            push_left_path(tree_root_);
+        }
+
+        /**
+         * @brief Проверяет, завершен ли обход.
+         * @return true, если все узлы пройдены.
+         */
+        bool is_end() const {
+            return node_stack.empty();
+        }
+
+        /**
+         * @brief Получает ключ текущего узла.
+         * @return Ключ текущего узла.
+         */
+        const key_type& key() const {
+            return node_stack.back()->key_t;
+        }
+
+        /**
+         * @brief Получает значение текущего узла.
+         * @return Значение текущего узла.
+         */
+        const value_type& value() const {
+            return node_stack.back()->value_t;
+        }
+
+        /**
+         * @brief Переходит к следующему по порядку узлу.
+         * @return Ссылка на итератор.
+         */
+        inorder_iterator& operator++() {
+            const tree_node* current = node_stack.back();
+            node_stack.pop_back();
+            push_left_path(current->right_child);
+            return *this;
+        }
+    };
+
     /**
      * @brief Конструктор по умолчанию.
      */
-    binary_tree() : tree_root(nullptr) {}
+    binary_tree() : tree_root(nullptr), node_count(0), content_fingerprint(0) {}
 
     /**
      * @brief Деструктор. Освобождает занятую память.
@@ -339,12 +790,47 @@ public:
      * @brief Конструктор копирования.
      * @param other Корень другого дерева для копирования
      */
-    binary_tree(const binary_tree& other) : tree_root(nullptr) {
+    binary_tree(const binary_tree& other)
+            : tree_root(nullptr), node_count(other.node_count), content_fingerprint(other.get_fingerprint()) {
         if (other.tree_root) {
             tree_root = copy_tree(other.tree_root);
         }
     }
 
+    /**
+     * @brief Конструктор перемещения.
+     * @param other Дерево, узлы которого забираются; остается пустым.
+     * @details Время O(1), узлы не копируются.
+     */
+    binary_tree(binary_tree&& other) noexcept
+            : tree_root(other.tree_root), node_count(other.node_count), content_fingerprint(other.content_fingerprint),
+              exposed_nodes(std::move(other.exposed_nodes)) {
+        other.tree_root = nullptr;
+        other.node_count = 0;
+        other.content_fingerprint = 0;
+        other.exposed_nodes.clear();
+    }
+
+    /**
+     * @brief Обменивает содержимое двух деревьев за O(1).
+     * @param other Дерево для обмена.
+     */
+    void swap(binary_tree& other) noexcept {
+        std::swap(tree_root, other.tree_root);
+        std::swap(node_count, other.node_count);
+        std::swap(content_fingerprint, other.content_fingerprint);
+        exposed_nodes.swap(other.exposed_nodes);
+    }
+
+    /**
+     * @brief Обменивает содержимое двух деревьев за O(1).
+     * @param first Первое дерево.
+     * @param second Второе дерево.
+     */
+    friend void swap(binary_tree& first, binary_tree& second) noexcept {
+        first.swap(second);
+    }
+
     /**
      * @brief Выполняет обход всего дерева в отсортированном порядке.
      * @param function_ Функция, которая будет вызвана для каждого узла.
@@ -359,19 +845,186 @@ public:
         inorder_traverse_helper(tree_root, function_);
     }
 
+    /**
+     * @brief Параллельно применяет функцию ко всем парам дерева.
+     * @tparam function Тип функции вида void(const key_type&, const value_type&).
+     * @param function_ Функция; вызывается одновременно из нескольких потоков
+     *                  и должна сама синхронизировать доступ к общим данным.
+     * @param thread_number Количество потоков, 0 - по числу ядер.
+     * @details Дерево делится на сбалансированные части по глубине, части обрабатываются
+     * потоками в произвольном порядке. Во время обхода дерево нельзя изменять.
+     * @throw Первое исключение, выброшенное функцией.
+     * @see parallel_reduce
+     */
+    template<typename function>
+    void parallel_for_each(function function_, size_t thread_number = 0) const {
+        auto prepared = prepare_segments(thread_number);
+        const std::vector<traversal_segment>& segments = prepared.first;
+        auto process_segment = [&](size_t index) {
+            inorder_traverse_helper(segments[index].subtree, function_);
+            if (segments[index].suffix_node) function_(segments[index].suffix_node->key_t, segments[index].suffix_node->value_t);
+        };
+        run_segments(segments.size(), prepared.second, process_segment);
+    }
+
+    /**
+     * @brief Параллельная свертка всех пар дерева.
+     * @tparam result_type Тип результата.
+     * @tparam accumulate_function Тип функции вида void(result_type&, const key_type&, const value_type&).
+     * @tparam combine_function Тип функции вида result_type(result_type, const result_type&).
+     * @param identity Начальное значение каждой частичной свертки.
+     * @param accumulate Добавляет пару к частичному результату.
+     * @param combine Объединяет два частичных результата, левый - с меньшими ключами.
+     * @param thread_number Количество потоков, 0 - по числу ядер.
+     * @return Результат свертки.
+     * @details Каждая часть дерева сворачивается в своем потоке в порядке возрастания ключей,
+     * затем частичные результаты объединяются слева направо в порядке ключей. Поэтому при
+     * ассоциативной combine результат совпадает с последовательной сверткой даже для
+     * некоммутативных операций, например склейки списков.
+     * @throw Первое исключение, выброшенное accumulate.
+     * @see parallel_for_each
+     */
+    template<typename result_type, typename accumulate_function, typename combine_function>
+    result_type parallel_reduce(const result_type& identity, accumulate_function accumulate,
+                                combine_function combine, size_t thread_number = 0) const {
+        struct partial_slot {
+            result_type value;
+        };
+        auto prepared = prepare_segments(thread_number);
+        const std::vector<traversal_segment>& segments = prepared.first;
+        std::vector<partial_slot> partial_results(segments.size(), partial_slot{identity});
+        auto process_segment = [&](size_t index) {
+            result_type& partial_result = partial_results[index].value;
+            auto accumulate_entry = [&](const key_type& key_, const value_type& value_) {
+                accumulate(partial_result, key_, value_);
+            };
+            inorder_traverse_helper(segments[index].subtree, accumulate_entry);
+            if (segments[index].suffix_node) accumulate_entry(segments[index].suffix_node->key_t, segments[index].suffix_node->value_t);
+        };
+        run_segments(segments.size(), prepared.second, process_segment);
+        result_type result = identity;
+        for (const partial_slot& partial_result : partial_results) result = combine(std::move(result), partial_result.value);
+        return result;
+    }
+
+    /**
+     * @brief Получает итератор на наименьший ключ дерева.
+     * @return Итератор обхода в порядке возрастания ключей.
+     * @see inorder_iterator
+     */
+    inorder_iterator begin_inorder() const {
+        return inorder_iterator(tree_root);
+    }
+
+    template<typename resolver>
+    /**
+     * @brief Добавляет в дерево все узлы другого дерева.
+     * @param other Дерево, узлы которого добавляются.
+     * @param resolver_ Функция вида value_type(const key_type&, const value_type& own, const value_type& other),
+     *                  выбирающая значение для ключей, которые есть в обоих деревьях.
+     * @details Объединение строится делением и соединением деревьев (join-based),
+     *          время O(m log(n/m + 1)) плюс копирование второго дерева. Второе дерево
+     *          сначала копируется целиком, поэтому нехватка памяти при копировании
+     *          оставляет текущее дерево без изменений.
+     * @see union_trees
+     */
+    void merge_with(const binary_tree& other, resolver resolver_) {
+        if (this == &other) return;
+        binary_tree other_copy(other);
+        tree_node* other_root = std::exchange(other_copy.tree_root, nullptr);
+        uint64_t other_fingerprint = std::exchange(other_copy.content_fingerprint, 0);
+        size_t other_count = std::exchange(other_copy.node_count, 0);
+        tree_root = union_trees(tree_root, other_root, resolver_);
+        content_fingerprint += other_fingerprint;
+        node_count += other_count;
+    }
+
     /**
      * @brief Оператор присваивания
      * @param[in] other Словарь для присваивания
      * @return Ссылка на текущий объект дерева
      */
     binary_tree& operator=(const binary_tree& other) {
+        if (this != &other) {
+            binary_tree copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Оператор присваивания с перемещением
+     * @param[in] other Дерево, узлы которого забираются; остается пустым
+     * @return Ссылка на текущий объект дерева
+     * @details Прежние узлы текущего дерева удаляются, узлы other не копируются.
+     */
+    binary_tree& operator=(binary_tree&& other) noexcept {
         if (this != &other) {
             clear_tree();
-            this->tree_root = copy_tree(other.tree_root);
+            swap(other);
         }
         return *this;
     }
 
+    /**
+     * @brief Извлекает узел из дерева без удаления.
+     * @param key_to_extract Ключ узла.
+     * @return node_handle с узлом или пустой, если ключа нет.
+     * @details Дерево делится по ключу и соединяется обратно без этого узла, время O(log n).
+     * @see insert
+     */
+    node_handle extract(const key_type& key_to_extract) {
+        if (!search_node(key_to_extract)) return node_handle();
+        tree_node *left_tree, *found_node, *right_tree;
+        split_tree(tree_root, key_to_extract, left_tree, found_node, right_tree);
+        tree_root = join_two_trees(left_tree, right_tree);
+        forget_entry(found_node);
+        return node_handle(found_node);
+    }
+
+    /**
+     * @brief Вставляет извлеченный узел.
+     * @param handle Узел, полученный из extract этого или другого дерева.
+     * @return true если узел вставлен и handle стал пустым; false если handle пуст
+     *         или ключ уже есть в дереве, тогда узел остается в handle.
+     * @details Память не выделяется, время O(log n).
+     * @see extract
+     */
+    bool insert(node_handle&& handle) {
+        tree_node* new_node = handle.owned_node;
+        if (!new_node || search_node(new_node->key_t)) return false;
+        new_node->left_child = new_node->right_child = nullptr;
+        new_node->node_height = 1;
+        tree_root = insert_existing_node(tree_root, new_node);
+        remember_entry(new_node);
+        handle.owned_node = nullptr;
+        return true;
+    }
+
+    /**
+     * @brief Переносит из другого дерева узлы с ключами, которых нет в текущем.
+     * @param other Дерево-источник; в нем остаются только узлы с совпавшими ключами.
+     * @details Узлы переставляются между деревьями без выделения памяти и копирования,
+     *          время O(m log(n + m)), где m - размер other.
+     * @see merge_with
+     */
+    void merge(binary_tree& other) {
+        if (this == &other) return;
+        tree_node* remaining_tree = nullptr;
+        while (other.tree_root) {
+            tree_node* current;
+            other.tree_root = other.detach_min(other.tree_root, current);
+            if (search_node(current->key_t)) {
+                remaining_tree = insert_existing_node(remaining_tree, current);
+            } else {
+                other.forget_entry(current);
+                remember_entry(current);
+                tree_root = insert_existing_node(tree_root, current);
+            }
+        }
+        other.tree_root = remaining_tree;
+    }
+
     /**
      * @brief Получает корень дерева.
      * @return Указатель на корень дерева.
@@ -383,11 +1036,15 @@ public:
     /**
      * @brief Оператор сравнения деревьев на равенство
      * @param[in] other Дерево для сравнения
-     * @return true если деревья идентичны, false в противном случае
+     * @return true если деревья содержат одинаковые пары ключ-значение, false в противном случае
+     * @details Деревья с разными отпечатками отвергаются за O(1); при совпадении
+     *          отпечатков содержимое сравнивается полностью.
      * @see operator!=
      * @see are_trees_equal
+     * @see get_fingerprint
      */
     bool operator==(const binary_tree& other) const {
+        if (get_fingerprint() != other.get_fingerprint()) return false;
         return are_trees_equal(tree_root, other.tree_root);
     }
 
@@ -411,6 +1068,8 @@ public:
     bool insert_helper(const key_type& key_to_insert, const value_type& value_to_insert) {
         if(search_node(key_to_insert)) return false;
         tree_root = insert_node(tree_root, key_to_insert, value_to_insert);
+        node_count++;
+        content_fingerprint += entry_hash(key_to_insert, value_to_insert);
         return true;
     }
 
@@ -420,20 +1079,89 @@ public:
      * @return true, если узел с таким ключом в дереве есть, и false в противном случае.
      */
     bool delete_helper(const key_type& key_to_delete) {
-        if(!search_node(key_to_delete)) return false;
+        tree_node *temporary = search_node(key_to_delete);
+        if(!temporary) return false;
+        forget_entry(temporary);
         tree_root = delete_node(tree_root, key_to_delete);
         return true;
     }
 
+    /**
+     * @brief Заменяет значение узла.
+     * @param key_to_find Ключ узла.
+     * @param new_value Новое значение.
+     * @return true, если узел найден, и false в противном случае.
+     * @details В отличие от записи через get_value, обновляет отпечаток дерева за O(1).
+     *          Если на значение выдавалась изменяемая ссылка, узел снова входит в хранимый
+     *          отпечаток: ссылку, полученную до set_value, больше не следует использовать для записи.
+     * @see get_fingerprint
+     */
+    bool set_value(const key_type& key_to_find, const value_type& new_value) {
+        tree_node *temporary = search_node(key_to_find);
+        if (!temporary) return false;
+        if (temporary->value_exposed) {
+            remove_exposed(temporary);
+            temporary->value_exposed = false;
+        } else {
+            content_fingerprint -= entry_hash(temporary->key_t, temporary->value_t);
+        }
+        temporary->value_t = new_value;
+        content_fingerprint += entry_hash(temporary->key_t, temporary->value_t);
+        return true;
+    }
+
+    /**
+     * @brief Изменяет значение узла на месте.
+     * @tparam modifier Тип функции вида void(value_type&).
+     * @param key_to_find Ключ узла.
+     * @param modifier_ Функция, изменяющая значение.
+     * @return true, если узел найден, и false в противном случае.
+     * @details Узел не пересоздается, а отпечаток обновляется за O(1), как в set_value.
+     *          Если функция бросает исключение, отпечаток пересчитывается обходом дерева.
+     * @see set_value
+     */
+    template<typename modifier>
+    bool modify_value(const key_type& key_to_find, modifier modifier_) {
+        tree_node *temporary = search_node(key_to_find);
+        if (!temporary) return false;
+        if (temporary->value_exposed) {
+            modifier_(temporary->value_t);
+            return true;
+        }
+        content_fingerprint -= entry_hash(temporary->key_t, temporary->value_t);
+        try {
+            modifier_(temporary->value_t);
+        } catch (...) {
+            recompute_fingerprint();
+            throw;
+        }
+        content_fingerprint += entry_hash(temporary->key_t, temporary->value_t);
+        return true;
+    }
+
+    /**
+     * @brief Получает отпечаток содержимого дерева.
+     * @return Сумма хешей всех пар ключ-значение по модулю 2^64.
+     * @details Отпечаток не зависит от формы дерева и обновляется за O(1) при вставке,
+     *          удалении и set_value. Узлы, на значения которых выдавалась изменяемая ссылка
+     *          через get_value, хешируются заново при каждом вызове, так как ссылка может
+     *          использоваться для записи и позже; время O(p), где p - число таких узлов.
+     *          Метод ничего не изменяет и безопасен при одновременных вызовах.
+     *          Для типов без std::hash отпечаток всегда равен 0.
+     */
+    uint64_t get_fingerprint() const {
+        uint64_t fingerprint = content_fingerprint;
+        for (const tree_node* node : exposed_nodes) fingerprint += entry_hash(node->key_t, node->value_t);
+        return fingerprint;
+    }
+
     /**
      * @brief Внешняя функция для определения размер дерева.
      * @return Количество узлов в дереве.
-     * @see tree_size
+     * @details Количество поддерживается при каждом изменении дерева, время O(1).
      */
     int get_size() const {
-        int word_counter = 0;
-        int number = tree_size(tree_root, word_counter);
-        return number;
+        return static_cast<int>(node_count);
     }
 
     /**
@@ -446,6 +1174,53 @@ public:
         return search_node(key_to_find);
     }
 
+    /**
+     * @brief Передает функции ключ и значение найденного узла.
+     * @tparam function Тип функции вида void(const key_type&, const value_type&).
+     * @param key_to_find Ключ для поиска.
+     * @param function_ Функция, вызываемая для узла.
+     * @return true, если узел найден, и false в противном случае.
+     * @details В отличие от get_value, дает доступ к ключу, хранящемуся в дереве.
+     */
+    template<typename function>
+    bool inspect_node(const key_type& key_to_find, function function_) const {
+        const tree_node *temporary = search_node(key_to_find);
+        if (!temporary) return false;
+        function_(temporary->key_t, temporary->value_t);
+        return true;
+    }
+
+    /**
+     * @brief Проверяет, выдавалась ли изменяемая ссылка на значение узла.
+     * @param key_to_find Ключ для поиска.
+     * @return true, если узел есть и на его значение выдавалась ссылка через get_value.
+     * @see for_each_exposed
+     */
+    bool is_value_exposed(const key_type& key_to_find) const {
+        const tree_node *temporary = search_node(key_to_find);
+        return temporary && temporary->value_exposed;
+    }
+
+    /**
+     * @brief Передает функции ключ и значение каждого узла, на значение которого выдавалась изменяемая ссылка.
+     * @tparam function Тип функции вида void(const key_type&, const value_type&).
+     * @param function_ Функция, вызываемая для узлов в порядке выдачи ссылок.
+     * @details Время O(p), где p - число таких узлов.
+     * @see get_value
+     */
+    template<typename function>
+    void for_each_exposed(function function_) const {
+        for (const tree_node* node : exposed_nodes) function_(node->key_t, node->value_t);
+    }
+
+    /**
+     * @brief Получает размер одного узла.
+     * @return Размер структуры узла в байтах без памяти, выделенной ключом и значением.
+     */
+    static constexpr size_t get_node_size() {
+        return sizeof(tree_node);
+    }
+
     /**
      * @brief Получает значение узла по ключу.
      * @param key_to_find Ключ для поиска.
@@ -462,12 +1237,21 @@ public:
      * @brief Получает значение узла для изменения.
      * @param key_to_find Ключ для поиска.
      * @return Значение узла, если он есть в дереве, и бросает ошибку в противном случае.
-     * @details Неконстантная версия
+     * @details Неконстантная версия. Так как значение может быть изменено по ссылке
+     *          в любой момент, пока узел в дереве, узел исключается из хранимого отпечатка
+     *          и хешируется заново при каждом get_fingerprint. Для записи без этих затрат
+     *          используйте set_value или modify_value.
+     * @see set_value
      */
     value_type& get_value(const key_type& key_to_find) {
         tree_node *temporary = search_node(key_to_find);
-        if (temporary) return temporary->value_t;
-        else throw std::out_of_range("Ключ не найден.");
+        if (!temporary) throw std::out_of_range("Ключ не найден.");
+        if (!temporary->value_exposed) {
+            content_fingerprint -= entry_hash(temporary->key_t, temporary->value_t);
+            temporary->value_exposed = true;
+            add_exposed(temporary);
+        }
+        return temporary->value_t;
     }
 
     /**
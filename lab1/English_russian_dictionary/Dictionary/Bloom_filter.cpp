@@ -0,0 +1,92 @@
+#include "Bloom_filter.h"
+#include <cmath>
+#include <algorithm>
+
+namespace {
+    const size_t block_bits = 512;
+}
+
+bloom_filter::bloom_filter(size_t expected_items, double false_positive_rate, bool blocked) : is_blocked(blocked) {
+    if (expected_items == 0) expected_items = 1;
+    if (false_positive_rate <= 0.0 || false_positive_rate >= 1.0) false_positive_rate = 0.01;
+    const double ln2 = std::log(2.0);
+    double optimal_bits = -static_cast<double>(expected_items) * std::log(false_positive_rate) / (ln2 * ln2);
+    bit_number = std::max<size_t>(64, static_cast<size_t>(std::ceil(optimal_bits)));
+    size_t granularity = is_blocked ? block_bits : 64;
+    bit_number = (bit_number + granularity - 1) / granularity * granularity;
+    double optimal_hashes = static_cast<double>(bit_number) / static_cast<double>(expected_items) * ln2;
+    hash_number = std::max<size_t>(1, static_cast<size_t>(std::round(optimal_hashes)));
+    filter_bits.assign(bit_number / 64, 0);
+}
+
+void bloom_filter::base_hashes(const std::string& key, uint64_t& first_hash, uint64_t& second_hash) {
+    first_hash = 14695981039346656037ULL;
+    for (unsigned char symbol : key) {
+        first_hash ^= symbol;
+        first_hash *= 1099511628211ULL;
+    }
+    second_hash = first_hash;
+    second_hash ^= second_hash >> 33;
+    second_hash *= 0xff51afd7ed558ccdULL;
+    second_hash ^= second_hash >> 33;
+    second_hash *= 0xc4ceb9fe1a85ec53ULL;
+    second_hash ^= second_hash >> 33;
+    second_hash |= 1;
+}
+
+void bloom_filter::add(const std::string& key) {
+    uint64_t first_hash, second_hash;
+    base_hashes(key, first_hash, second_hash);
+    if (is_blocked) {
+        uint64_t* block = filter_bits.data() + first_hash % (bit_number / block_bits) * (block_bits / 64);
+        uint32_t probe = static_cast<uint32_t>(first_hash >> 32);
+        for (size_t i = 0; i < hash_number; ++i, probe += static_cast<uint32_t>(second_hash)) {
+            size_t bit_index = probe % block_bits;
+            block[bit_index / 64] |= (uint64_t(1) << (bit_index % 64));
+        }
+        return;
+    }
+    for (size_t i = 0; i < hash_number; ++i) {
+        size_t bit_index = (first_hash + i * second_hash) % bit_number;
+        filter_bits[bit_index / 64] |= (uint64_t(1) << (bit_index % 64));
+    }
+}
+
+bool bloom_filter::possibly_contains(const std::string& key) const {
+    uint64_t first_hash, second_hash;
+    base_hashes(key, first_hash, second_hash);
+    if (is_blocked) {
+        const uint64_t* block = filter_bits.data() + first_hash % (bit_number / block_bits) * (block_bits / 64);
+        uint32_t probe = static_cast<uint32_t>(first_hash >> 32);
+        for (size_t i = 0; i < hash_number; ++i, probe += static_cast<uint32_t>(second_hash)) {
+            size_t bit_index = probe % block_bits;
+            if (!(block[bit_index / 64] & (uint64_t(1) << (bit_index % 64)))) return false;
+        }
+        return true;
+    }
+    for (size_t i = 0; i < hash_number; ++i) {
+        size_t bit_index = (first_hash + i * second_hash) % bit_number;
+        if (!(filter_bits[bit_index / 64] & (uint64_t(1) << (bit_index % 64)))) return false;
+    }
+    return true;
+}
+
+void bloom_filter::clear() {
+    std::fill(filter_bits.begin(), filter_bits.end(), 0);
+}
+
+size_t bloom_filter::get_bit_number() const {
+    return bit_number;
+}
+
+size_t bloom_filter::get_hash_number() const {
+    return hash_number;
+}
+
+bool bloom_filter::is_blocked_filter() const {
+    return is_blocked;
+}
+
+size_t bloom_filter::memory_bytes() const {
+    return filter_bits.size() * sizeof(uint64_t);
+}
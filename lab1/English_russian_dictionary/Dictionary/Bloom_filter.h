@@ -0,0 +1,93 @@
+/**
+ * @file Bloom_filter.h
+ * @author Ященко Александра
+ * @brief Заголовочный файл фильтра Блума для строковых ключей.
+ */
+
+#ifndef SEM3_L1_PPOIS_BLOOM_FILTER_H
+#define SEM3_L1_PPOIS_BLOOM_FILTER_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @class bloom_filter
+ * @brief Вероятностное множество строк без ложноотрицательных ответов.
+ * @details Хранит битовый массив и набор хеш-функций, полученных двойным хешированием.
+ * Если possibly_contains возвращает false, ключ гарантированно не добавлялся;
+ * true означает, что ключ, вероятно, добавлялся.
+ *
+ * В блочном режиме все биты одного ключа лежат в одном блоке из 512 бит (строка кэша),
+ * поэтому проверка ключа читает одну строку кэша вместо hash_number случайных.
+ * Доля ложных срабатываний при этом немного выше расчетной.
+ */
+class bloom_filter {
+private:
+    std::vector<uint64_t> filter_bits; ///< Битовый массив фильтра
+    size_t bit_number; ///< Количество бит в фильтре
+    size_t hash_number; ///< Количество хеш-функций
+    bool is_blocked; ///< Лежат ли биты одного ключа в одном блоке
+
+    /**
+     * @brief Вычисляет пару базовых хешей ключа.
+     * @param key Ключ для хеширования.
+     * @param first_hash Первый хеш.
+     * @param second_hash Второй хеш (всегда нечетный).
+     */
+    static void base_hashes(const std::string& key, uint64_t& first_hash, uint64_t& second_hash);
+
+public:
+    /**
+     * @brief Конструктор по ожидаемому числу ключей и доле ложных срабатываний.
+     * @param expected_items Ожидаемое количество ключей.
+     * @param false_positive_rate Допустимая доля ложных срабатываний (0; 1).
+     * @param blocked Использовать блочный режим.
+     */
+    explicit bloom_filter(size_t expected_items = 1024, double false_positive_rate = 0.01, bool blocked = false);
+
+    /**
+     * @brief Добавляет ключ в фильтр.
+     * @param key Ключ для добавления.
+     */
+    void add(const std::string& key);
+
+    /**
+     * @brief Проверяет, мог ли ключ быть добавлен в фильтр.
+     * @param key Ключ для проверки.
+     * @return false, если ключа точно нет, и true в противном случае.
+     */
+    bool possibly_contains(const std::string& key) const;
+
+    /**
+     * @brief Очищает фильтр, сохраняя его размер.
+     */
+    void clear();
+
+    /**
+     * @brief Получение размера фильтра в битах.
+     * @return Количество бит.
+     */
+    size_t get_bit_number() const;
+
+    /**
+     * @brief Получение количества хеш-функций.
+     * @return Количество хеш-функций.
+     */
+    size_t get_hash_number() const;
+
+    /**
+     * @brief Проверка режима фильтра.
+     * @return true если фильтр блочный.
+     */
+    bool is_blocked_filter() const;
+
+    /**
+     * @brief Получение объема памяти, занятой битовым массивом.
+     * @return Размер в байтах.
+     */
+    size_t memory_bytes() const;
+};
+
+#endif //SEM3_L1_PPOIS_BLOOM_FILTER_H
@@ -0,0 +1,79 @@
+/**
+ * @file Core_vocabulary.h
+ * @author Ященко Александра
+ * @brief Базовый словарь, встроенный в программу.
+ * @details Словарь строится и сортируется компилятором, поэтому его не нужно
+ * загружать через read_from_file при запуске. Чтобы добавить слово, достаточно
+ * дописать пару в список: порядок не важен, повтор слова не скомпилируется.
+ */
+
+#ifndef SEM3_L1_PPOIS_CORE_VOCABULARY_H
+#define SEM3_L1_PPOIS_CORE_VOCABULARY_H
+
+#include "Static_dictionary.h"
+
+/**
+ * @brief Базовый англо-русский словарь.
+ */
+inline constexpr auto core_vocabulary = make_static_dictionary({
+        {"hello", "привет"},
+        {"world", "мир"},
+        {"apple", "яблоко"},
+        {"book", "книга"},
+        {"cat", "кошка"},
+        {"dog", "собака"},
+        {"house", "дом"},
+        {"water", "вода"},
+        {"sun", "солнце"},
+        {"moon", "луна"},
+        {"tree", "дерево"},
+        {"city", "город"},
+        {"friend", "друг"},
+        {"family", "семья"},
+        {"mother", "мать"},
+        {"father", "отец"},
+        {"school", "школа"},
+        {"teacher", "учитель"},
+        {"student", "студент"},
+        {"table", "стол"},
+        {"chair", "стул"},
+        {"window", "окно"},
+        {"door", "дверь"},
+        {"time", "время"},
+        {"day", "день"},
+        {"night", "ночь"},
+        {"year", "год"},
+        {"work", "работа"},
+        {"word", "слово"},
+        {"language", "язык"},
+        {"good", "хороший"},
+        {"bad", "плохой"},
+        {"big", "большой"},
+        {"small", "маленький"},
+        {"new", "новый"},
+        {"old", "старый"},
+        {"red", "красный"},
+        {"green", "зеленый"},
+        {"blue", "синий"},
+        {"white", "белый"},
+        {"black", "черный"},
+        {"go", "идти"},
+        {"read", "читать"},
+        {"write", "писать"},
+        {"speak", "говорить"},
+        {"see", "видеть"},
+        {"know", "знать"},
+        {"love", "любовь"},
+        {"food", "еда"},
+        {"bread", "хлеб"},
+        {"milk", "молоко"},
+        {"car", "машина"},
+        {"road", "дорога"},
+        {"money", "деньги"},
+        {"thank you", "спасибо"},
+        {"good morning", "доброе утро"},
+        {"look after", "присматривать за"},
+        {"give up", "сдаваться"},
+});
+
+#endif //SEM3_L1_PPOIS_CORE_VOCABULARY_H
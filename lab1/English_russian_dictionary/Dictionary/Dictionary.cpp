@@ -2,6 +2,10 @@
 #include <iostream>
 #include <fstream>
 #include <stdexcept>
+#include <algorithm>
+#include <charconv>
+#include <utility>
+#include <cstdio>
 #include "Dictionary.h"
 #include "string_validator.h"
 
@@ -14,22 +18,139 @@ std::ostream& operator<<(std::ostream& output, const dictionary& dict_to_print)
     return output;
 }
 
-std::istream& operator>>(std::istream& input, dictionary& dictionary){
-    std::string current_line;
-    while (std::getline(input, current_line)){
-        if (!current_line.empty()){
-            try {
-                std::pair<std::string, std::string> new_pair = string_validator::word_pair_input(current_line);
-                if (!dictionary.contains_word(new_pair.first)) dictionary+=new_pair;
-            } catch (const std::invalid_argument& exception) {
+namespace {
+    size_t string_heap_bytes(const std::string& text) {
+        static const size_t inline_capacity = std::string().capacity();
+        return text.capacity() > inline_capacity ? text.capacity() + 1 : 0;
+    }
+
+    size_t allocation_overhead(size_t requested_bytes) {
+        if (requested_bytes == 0) return 0;
+        size_t block_bytes = std::max<size_t>(32, (requested_bytes + 8 + 15) & ~size_t(15));
+        return block_bytes - requested_bytes;
+    }
+
+    const size_t export_buffer_size = 1 << 20;
+    /**
+     * При сборе пачки обход читает у узла только указатели на потомков, а ключ и
+     * значение лежат в начале узла, в другой кэш-линии. Поэтому эти строки к моменту
+     * форматирования еще не в кэше, и их стоит запросить заранее через prefetch_entry.
+     */
+    const size_t export_batch_size = 256;
+    const size_t export_prefetch_distance = 16;
+
+    void prefetch_entry(const void* address) {
+#if defined(__GNUC__)
+        __builtin_prefetch(address);
+#else
+        (void)address;
+#endif
+    }
 
+    void append_tsv_field(std::string& buffer, const std::string& field) {
+        if (field.find_first_of("\t\n\r\\") == std::string::npos) {
+            buffer += field;
+            return;
+        }
+        for (char symbol : field) {
+            switch (symbol) {
+                case '\t': buffer += "\\t"; break;
+                case '\n': buffer += "\\n"; break;
+                case '\r': buffer += "\\r"; break;
+                case '\\': buffer += "\\\\"; break;
+                default: buffer += symbol;
+            }
+        }
+    }
+
+    void append_json_string(std::string& buffer, const std::string& field) {
+        buffer += '"';
+        if (std::none_of(field.begin(), field.end(), [](char symbol) {
+                return symbol == '"' || symbol == '\\' || static_cast<unsigned char>(symbol) < 0x20;
+            })) {
+            buffer += field;
+            buffer += '"';
+            return;
+        }
+        for (char symbol : field) {
+            switch (symbol) {
+                case '"': buffer += "\\\""; break;
+                case '\\': buffer += "\\\\"; break;
+                case '\n': buffer += "\\n"; break;
+                case '\r': buffer += "\\r"; break;
+                case '\t': buffer += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(symbol) < 0x20) {
+                        char escaped[7];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(symbol));
+                        buffer += escaped;
+                    } else {
+                        buffer += symbol;
+                    }
             }
         }
+        buffer += '"';
     }
+}
+
+size_t dictionary::export_to(std::ostream& output, export_format format) const {
+    std::string buffer;
+    buffer.reserve(export_buffer_size + 256);
+    std::vector<std::pair<const std::string*, const std::string*>> batch;
+    batch.reserve(export_batch_size);
+    size_t counter = 0;
+    auto format_batch = [&]() {
+        for (size_t i = 0; i < batch.size(); ++i) {
+            if (i + export_prefetch_distance < batch.size()) prefetch_entry(batch[i + export_prefetch_distance].first);
+            const std::string& english_word = *batch[i].first;
+            const std::string& russian_word = *batch[i].second;
+            ++counter;
+            if (format == export_format::plain) {
+                char digits[24];
+                auto result = std::to_chars(digits, digits + sizeof(digits), counter);
+                buffer.append(digits, result.ptr);
+                buffer += ". ";
+                buffer += english_word;
+                buffer += " - ";
+                buffer += russian_word;
+            } else if (format == export_format::tsv) {
+                append_tsv_field(buffer, english_word);
+                buffer += '\t';
+                append_tsv_field(buffer, russian_word);
+            } else {
+                buffer += "{\"english\":";
+                append_json_string(buffer, english_word);
+                buffer += ",\"russian\":";
+                append_json_string(buffer, russian_word);
+                buffer += '}';
+            }
+            buffer += '\n';
+            if (buffer.size() >= export_buffer_size) {
+                output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                buffer.clear();
+            }
+        }
+        batch.clear();
+    };
+    dictionary_tree.inorder_traverse(
+            [&](const std::string& english_word, const std::string& russian_word) {
+                batch.emplace_back(&english_word, &russian_word);
+                if (batch.size() == export_batch_size) format_batch();
+            });
+    format_batch();
+    output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    return counter;
+}
+
+std::istream& operator>>(std::istream& input, dictionary& dictionary){
+    string_validator::read_word_pairs(input, [&dictionary](const std::pair<std::string, std::string>& new_pair) {
+        if (!dictionary.contains_word(new_pair.first)) dictionary += new_pair;
+    });
     return input;
 }
 
 bool dictionary::contains_word(const std::string& english_word) const{
+    if (key_filter && !key_filter->possibly_contains(english_word)) return false;
     return dictionary_tree.contains_node(english_word);
 }
 
@@ -38,27 +159,35 @@ const std::string& dictionary::operator[](const std::string& input_word) const {
 }
 
 std::string& dictionary::operator[](const std::string& input_word) {
+    count_erased(input_word);
     return dictionary_tree.get_value(input_word);
 }
 
+void dictionary::set_translation(const std::string& english_word, const std::string& russian_word) {
+    count_erased(english_word);
+    if (!dictionary_tree.set_value(english_word, russian_word)) throw std::out_of_range("Ключ не найден.");
+    count_inserted(english_word);
+}
+
 dictionary& dictionary::operator+=(const std::pair<std::string, std::string>& english_russian_pair) {
     if (!dictionary_tree.insert_helper(english_russian_pair.first,english_russian_pair.second)) {
         throw std::invalid_argument("Слово уже существует в словаре");
     }
+    key_filter_insert(english_russian_pair.first);
+    count_inserted(english_russian_pair.first);
     return *this;
 }
 
 dictionary& dictionary::operator+=(const std::pair<const char*, const char*>& english_russian_pair) {
-    if (!dictionary_tree.insert_helper(english_russian_pair.first,english_russian_pair.second)) {
-        throw std::invalid_argument("Слово уже существует в словаре");
-    }
-    return *this;
+    return *this += std::make_pair(std::string(english_russian_pair.first), std::string(english_russian_pair.second));
 }
 
 dictionary& dictionary::operator-=(const std::string& english_word) {
+    count_erased(english_word);
     if (!dictionary_tree.delete_helper(english_word)) {
         throw std::invalid_argument("Слова не существует в словаре");
     }
+    key_filter_erase();
     return *this;
 }
 
@@ -70,6 +199,242 @@ bool dictionary::operator!=(const dictionary& other) const {
     return !(*this == other);
 }
 
+uint64_t dictionary::get_fingerprint() const {
+    return dictionary_tree.get_fingerprint();
+}
+
+std::vector<dictionary_change> dictionary::diff(const dictionary& other) const {
+    std::vector<dictionary_change> changes;
+    auto own = dictionary_tree.begin_inorder();
+    auto incoming = other.dictionary_tree.begin_inorder();
+    while (!own.is_end() || !incoming.is_end()) {
+        if (incoming.is_end() || (!own.is_end() && own.key() < incoming.key())) {
+            changes.push_back({dictionary_change::removed, own.key(), own.value(), ""});
+            ++own;
+        } else if (own.is_end() || incoming.key() < own.key()) {
+            changes.push_back({dictionary_change::added, incoming.key(), "", incoming.value()});
+            ++incoming;
+        } else {
+            if (own.value() != incoming.value()) {
+                changes.push_back({dictionary_change::changed, own.key(), own.value(), incoming.value()});
+            }
+            ++own;
+            ++incoming;
+        }
+    }
+    return changes;
+}
+
+dictionary& dictionary::apply_changes(const std::vector<dictionary_change>& changes) {
+    for (const dictionary_change& change : changes) {
+        count_erased(change.english_word);
+        if (change.type == dictionary_change::removed) {
+            if (dictionary_tree.delete_helper(change.english_word)) key_filter_erase();
+            continue;
+        } else if (dictionary_tree.insert_helper(change.english_word, change.new_translation)) {
+            key_filter_insert(change.english_word);
+        } else {
+            dictionary_tree.set_value(change.english_word, change.new_translation);
+        }
+        count_inserted(change.english_word);
+    }
+    return *this;
+}
+
+dictionary& dictionary::merge(const dictionary& other, merge_policy policy) {
+    dictionary_tree.merge_with(other.dictionary_tree,
+                               [policy](const std::string&, const std::string& own_translation,
+                                        const std::string& other_translation) {
+                                   return policy == merge_policy::keep_own ? own_translation : other_translation;
+                               });
+    rebuild_memory_counters();
+    if (key_filter) {
+        if (static_cast<size_t>(get_size()) > key_filter_capacity) {
+            rebuild_key_filter();
+        } else {
+            other.for_each_word([this](const std::string& english_word, const std::string&) {
+                key_filter->add(english_word);
+            });
+        }
+    }
+    return *this;
+}
+
+dictionary::dictionary(const dictionary& other)
+        : dictionary_tree(other.dictionary_tree), key_filter(other.key_filter),
+          key_filter_capacity(other.key_filter_capacity), key_filter_deletions(other.key_filter_deletions),
+          key_filter_rate(other.key_filter_rate), key_filter_blocked(other.key_filter_blocked) {
+    rebuild_memory_counters();
+}
+
+dictionary& dictionary::operator=(const dictionary& other) {
+    if (this != &other) {
+        dictionary copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+dictionary::dictionary(dictionary&& other) noexcept {
+    swap(other);
+}
+
+dictionary& dictionary::operator=(dictionary&& other) noexcept {
+    if (this != &other) {
+        dictionary moved(std::move(other));
+        swap(moved);
+    }
+    return *this;
+}
+
+dictionary& dictionary::splice(dictionary& other) {
+    if (this == &other) return *this;
+    dictionary_tree.merge(other.dictionary_tree);
+    rebuild_memory_counters();
+    other.rebuild_memory_counters();
+    if (key_filter) rebuild_key_filter();
+    if (other.key_filter) other.rebuild_key_filter();
+    return *this;
+}
+
+void dictionary::swap(dictionary& other) noexcept {
+    dictionary_tree.swap(other.dictionary_tree);
+    key_filter.swap(other.key_filter);
+    std::swap(key_filter_capacity, other.key_filter_capacity);
+    std::swap(key_filter_deletions, other.key_filter_deletions);
+    std::swap(key_filter_rate, other.key_filter_rate);
+    std::swap(key_filter_blocked, other.key_filter_blocked);
+    std::swap(memory, other.memory);
+}
+
+void dictionary::rebuild_key_filter() {
+    key_filter_capacity = std::max<size_t>(1024, 2 * static_cast<size_t>(get_size()));
+    key_filter_deletions = 0;
+    key_filter.emplace(key_filter_capacity, key_filter_rate, key_filter_blocked);
+    for_each_word([this](const std::string& english_word, const std::string&) {
+        key_filter->add(english_word);
+    });
+}
+
+void dictionary::key_filter_insert(const std::string& english_word) {
+    if (!key_filter) return;
+    if (static_cast<size_t>(get_size()) > key_filter_capacity) rebuild_key_filter();
+    else key_filter->add(english_word);
+}
+
+void dictionary::key_filter_erase() {
+    if (!key_filter) return;
+    if (++key_filter_deletions * 4 > key_filter_capacity) rebuild_key_filter();
+}
+
+void dictionary::enable_key_filter(double false_positive_rate, bool blocked) {
+    key_filter_rate = false_positive_rate;
+    key_filter_blocked = blocked;
+    rebuild_key_filter();
+}
+
+void dictionary::disable_key_filter() {
+    key_filter.reset();
+}
+
+bool dictionary::has_key_filter() const {
+    return key_filter.has_value();
+}
+
+size_t dictionary::get_key_filter_memory() const {
+    return key_filter ? key_filter->memory_bytes() : 0;
+}
+
+void dictionary::count_entry(memory_counters& counters, const std::string& english_word,
+                             const std::string& russian_word, bool added) {
+    size_t key_bytes = string_heap_bytes(english_word);
+    size_t value_bytes = string_heap_bytes(russian_word);
+    size_t overhead_bytes = allocation_overhead(key_bytes) + allocation_overhead(value_bytes);
+    size_t length = std::min(english_word.size(), memory_usage_report::key_length_limit);
+    if (counters.key_length_counts.size() <= length) counters.key_length_counts.resize(length + 1, 0);
+    if (added) {
+        counters.key_heap_bytes += key_bytes;
+        counters.value_heap_bytes += value_bytes;
+        counters.string_overhead_bytes += overhead_bytes;
+        counters.key_length_counts[length]++;
+    } else {
+        counters.key_heap_bytes -= key_bytes;
+        counters.value_heap_bytes -= value_bytes;
+        counters.string_overhead_bytes -= overhead_bytes;
+        counters.key_length_counts[length]--;
+    }
+}
+
+void dictionary::count_inserted(const std::string& english_word) {
+    if (dictionary_tree.is_value_exposed(english_word)) return;
+    dictionary_tree.inspect_node(english_word, [this](const std::string& key_, const std::string& value_) {
+        count_entry(memory, key_, value_, true);
+    });
+}
+
+void dictionary::count_erased(const std::string& english_word) {
+    if (dictionary_tree.is_value_exposed(english_word)) return;
+    dictionary_tree.inspect_node(english_word, [this](const std::string& key_, const std::string& value_) {
+        count_entry(memory, key_, value_, false);
+    });
+}
+
+void dictionary::rebuild_memory_counters() {
+    memory = memory_counters();
+    for_each_word([this](const std::string& english_word, const std::string& russian_word) {
+        count_entry(memory, english_word, russian_word, true);
+    });
+    dictionary_tree.for_each_exposed([this](const std::string& english_word, const std::string& russian_word) {
+        count_entry(memory, english_word, russian_word, false);
+    });
+}
+
+memory_usage_report dictionary::memory_usage() const {
+    memory_counters exposed;
+    dictionary_tree.for_each_exposed([&exposed](const std::string& english_word, const std::string& russian_word) {
+        count_entry(exposed, english_word, russian_word, true);
+    });
+    memory_usage_report report;
+    const size_t node_size = binary_tree<std::string, std::string>::get_node_size();
+    report.word_number = static_cast<size_t>(get_size());
+    report.node_bytes = report.word_number * node_size;
+    report.key_heap_bytes = memory.key_heap_bytes + exposed.key_heap_bytes;
+    report.value_heap_bytes = memory.value_heap_bytes + exposed.value_heap_bytes;
+    report.allocator_overhead_bytes = report.word_number * allocation_overhead(node_size) +
+                                      memory.string_overhead_bytes + exposed.string_overhead_bytes;
+    report.key_filter_bytes = get_key_filter_memory();
+    std::vector<size_t>& histogram = report.key_length_histogram;
+    histogram.assign(std::max(memory.key_length_counts.size(), exposed.key_length_counts.size()), 0);
+    for (size_t length = 0; length < histogram.size(); ++length) {
+        if (length < memory.key_length_counts.size()) histogram[length] += memory.key_length_counts[length];
+        if (length < exposed.key_length_counts.size()) histogram[length] += exposed.key_length_counts[length];
+    }
+    while (!histogram.empty() && histogram.back() == 0) histogram.pop_back();
+    return report;
+}
+
+size_t memory_usage_report::total_bytes() const {
+    return node_bytes + key_heap_bytes + value_heap_bytes + allocator_overhead_bytes + key_filter_bytes;
+}
+
+std::ostream& operator<<(std::ostream& output, const memory_usage_report& report) {
+    output << "Слов: " << report.word_number << "\n"
+           << "  узлы дерева: " << report.node_bytes << " байт\n"
+           << "  буферы слов: " << report.key_heap_bytes << " байт\n"
+           << "  буферы переводов: " << report.value_heap_bytes << " байт\n"
+           << "  служебная память распределителя: " << report.allocator_overhead_bytes << " байт\n"
+           << "  фильтр Блума: " << report.key_filter_bytes << " байт\n"
+           << "  всего: " << report.total_bytes() << " байт";
+    if (report.word_number) output << " (" << report.total_bytes() / report.word_number << " байт на слово)";
+    output << "\nДлины слов:\n";
+    for (size_t length = 0; length < report.key_length_histogram.size(); ++length) {
+        if (report.key_length_histogram[length] == 0) continue;
+        output << "  " << length << (length == memory_usage_report::key_length_limit ? "+" : "") << ": "
+               << report.key_length_histogram[length] << "\n";
+    }
+    return output;
+}
+
 int dictionary::get_size() const {
     return dictionary_tree.get_size();
 }
@@ -86,4 +451,13 @@ void dictionary::read_from_file(const std::string& file_name) {
     }
 }
 
-
+bool dictionary::write_to_file(const std::string& file_name) const {
+    std::ofstream txt_file(file_name, std::ios::binary | std::ios::trunc);
+    if (!txt_file.is_open()) return false;
+    dictionary_tree.inorder_traverse(
+            [&txt_file](const std::string& english_word, const std::string& russian_word) {
+                txt_file << english_word << " - " << russian_word << '\n';
+            });
+    txt_file.close();
+    return !txt_file.fail();
+}
@@ -8,7 +8,85 @@
 #define SEM3_L1_PPOIS_DICTIONARY_H
 
 #include <string>
+#include <vector>
+#include <cstdint>
+#include <optional>
 #include "Binary_tree.h"
+#include "Bloom_filter.h"
+
+/**
+ * @struct dictionary_change
+ * @brief Одно различие между двумя словарями
+ * @see dictionary::diff
+ */
+struct dictionary_change {
+    /**
+     * @brief Вид различия
+     */
+    enum change_type {
+        added, ///< Слово есть только во втором словаре
+        removed, ///< Слово есть только в первом словаре
+        changed ///< Слово есть в обоих словарях с разными переводами
+    };
+
+    change_type type; ///< Вид различия
+    std::string english_word; ///< Английское слово
+    std::string old_translation; ///< Перевод в первом словаре (пуст для added)
+    std::string new_translation; ///< Перевод во втором словаре (пуст для removed)
+};
+
+/**
+ * @brief Правило выбора перевода при объединении словарей
+ * @see dictionary::merge
+ */
+enum class merge_policy {
+    keep_own, ///< Оставить перевод текущего словаря
+    take_other ///< Взять перевод из добавляемого словаря
+};
+
+/**
+ * @brief Формат выгрузки словаря
+ * @see dictionary::export_to
+ */
+enum class export_format {
+    plain, ///< Нумерованные строки "1. слово - перевод", как у operator<<
+    tsv, ///< Строки "слово<TAB>перевод", символы \t, \n, \r и \\ экранируются
+    json_lines ///< По одному JSON-объекту {"english":...,"russian":...} на строку
+};
+
+/**
+ * @struct memory_usage_report
+ * @brief Оценка памяти, занятой словарем
+ * @details Буферы строк считаются по емкости, служебная память распределителя -
+ * по модели glibc malloc: к запросу добавляется 8 байт заголовка, размер блока
+ * округляется вверх до 16 байт и не бывает меньше 32 байт.
+ * @see dictionary::memory_usage
+ */
+struct memory_usage_report {
+    static constexpr size_t key_length_limit = 64; ///< Слова не короче этой длины попадают в последний столбец гистограммы
+
+    size_t word_number = 0; ///< Количество слов
+    size_t node_bytes = 0; ///< Структуры узлов дерева вместе с объектами строк внутри них
+    size_t key_heap_bytes = 0; ///< Буферы английских слов, не поместившихся во внутренний буфер строки
+    size_t value_heap_bytes = 0; ///< Буферы переводов, не поместившихся во внутренний буфер строки
+    size_t allocator_overhead_bytes = 0; ///< Заголовки и выравнивание блоков узлов и буферов
+    size_t key_filter_bytes = 0; ///< Фильтр Блума, если включен
+    std::vector<size_t> key_length_histogram; ///< Количество слов каждой длины в байтах, индекс - длина
+
+    /**
+     * @brief Получение общего объема памяти
+     * @return Сумма всех составляющих в байтах
+     */
+    size_t total_bytes() const;
+};
+
+/**
+ * @brief Вывод отчета о памяти
+ * @param[out] output Выходной поток
+ * @param[in] report Отчет
+ * @return Ссылка на выходной поток
+ */
+std::ostream& operator<<(std::ostream& output, const memory_usage_report& report);
 
 /**
  * @class dictionary
@@ -17,12 +95,114 @@
  * Предоставляет операции добавления, удаления, поиска слов, а также ввода/вывода.
  * Словарь автоматически поддерживает сбалансированность дерева для обеспечения
  * эффективного доступа к элементам.
+ *
+ * Перед деревом можно включить фильтр Блума по английским словам (enable_key_filter):
+ * тогда contains_word для большинства отсутствующих слов отвечает без спуска по дереву.
  */
 class dictionary{
 private:
     binary_tree<std::string, std::string> dictionary_tree; ///< Бинарное дерево для хранения пар слово-перевод
+    std::optional<bloom_filter> key_filter; ///< Фильтр Блума по английским словам, если включен
+    size_t key_filter_capacity = 0; ///< Количество слов, на которое рассчитан фильтр
+    size_t key_filter_deletions = 0; ///< Количество удалений после построения фильтра
+    double key_filter_rate = 0.01; ///< Допустимая доля ложных срабатываний фильтра
+    bool key_filter_blocked = true; ///< Используется ли блочный фильтр
+
+    /**
+     * @struct memory_counters
+     * @brief Счетчики памяти строк, обновляемые при изменении словаря
+     * @details Счетчики всегда актуальны, поэтому константный memory_usage только читает их
+     * и может вызываться из нескольких потоков. Копия словаря получает новые буферы строк,
+     * поэтому при копировании, merge и splice счетчики пересчитываются обходом словаря.
+     * Пары, перевод которых выдан по изменяемой ссылке через operator[], в счетчики
+     * не входят: они учитываются заново при каждом вызове memory_usage.
+     */
+    struct memory_counters {
+        size_t key_heap_bytes = 0; ///< Буферы английских слов в куче
+        size_t value_heap_bytes = 0; ///< Буферы переводов в куче
+        size_t string_overhead_bytes = 0; ///< Служебная память распределителя для буферов строк
+        std::vector<size_t> key_length_counts; ///< Количество слов каждой длины
+    };
+
+    memory_counters memory; ///< Счетчики памяти для memory_usage
+
+    /**
+     * @brief Строит фильтр заново по всем словам словаря
+     * @details Фильтр рассчитывается на вдвое большее число слов, чем есть сейчас,
+     * чтобы добавления не сразу ухудшали долю ложных срабатываний.
+     */
+    void rebuild_key_filter();
+
+    /**
+     * @brief Обновляет фильтр после добавления слова
+     * @param[in] english_word Добавленное слово
+     */
+    void key_filter_insert(const std::string& english_word);
+
+    /**
+     * @brief Учитывает удаление слова
+     * @details Когда число удалений превышает четверть расчетной емкости, фильтр перестраивается.
+     */
+    void key_filter_erase();
+
+    /**
+     * @brief Учитывает в счетчиках памяти одну пару
+     * @param[in,out] counters Счетчики
+     * @param[in] english_word Слово, хранящееся в дереве
+     * @param[in] russian_word Перевод, хранящийся в дереве
+     * @param[in] added true при добавлении пары, false при удалении
+     */
+    static void count_entry(memory_counters& counters, const std::string& english_word,
+                            const std::string& russian_word, bool added);
+
+    /**
+     * @brief Учитывает пару, только что добавленную в дерево
+     * @param[in] english_word Английское слово
+     */
+    void count_inserted(const std::string& english_word);
+
+    /**
+     * @brief Учитывает пару, которая сейчас будет удалена из дерева
+     * @param[in] english_word Английское слово
+     */
+    void count_erased(const std::string& english_word);
+
+    /**
+     * @brief Пересчитывает счетчики памяти обходом словаря за O(n)
+     */
+    void rebuild_memory_counters();
 
 public:
+    dictionary() = default;
+
+    /**
+     * @brief Конструктор копирования
+     * @param[in] other Копируемый словарь
+     * @details Счетчики памяти пересчитываются для буферов строк копии.
+     */
+    dictionary(const dictionary& other);
+
+    /**
+     * @brief Оператор копирующего присваивания
+     * @param[in] other Копируемый словарь
+     * @return Ссылка на текущий словарь
+     */
+    dictionary& operator=(const dictionary& other);
+
+    /**
+     * @brief Конструктор перемещения
+     * @param[in,out] other Словарь, узлы которого забираются; остается пустым и без фильтра
+     * @details Время O(1), узлы дерева не копируются.
+     */
+    dictionary(dictionary&& other) noexcept;
+
+    /**
+     * @brief Оператор присваивания с перемещением
+     * @param[in,out] other Словарь, узлы которого забираются; остается пустым и без фильтра
+     * @return Ссылка на текущий объект словаря
+     */
+    dictionary& operator=(dictionary&& other) noexcept;
+
     /**
      * @brief Проверяет наличие слова в словаре
      * @param[in] english_word Английское слово для поиска
@@ -42,10 +222,23 @@ public:
      * @brief Оператор доступа к переводу слова
      * @param[in] input_word Английское слово
      * @return Ссылка на русский перевод
+     * @details Перевод по ссылке можно изменить в любой момент, поэтому пара после
+     * этого учитывается в get_fingerprint и memory_usage заново при каждом вызове.
+     * Для записи без этих затрат используйте set_translation.
      * @see operator[](const std::string&) const
      */
     std::string& operator[](const std::string& input_word);
 
+    /**
+     * @brief Изменение перевода существующего слова
+     * @param[in] english_word Английское слово
+     * @param[in] russian_word Новый перевод
+     * @throw std::out_of_range если слова нет в словаре
+     * @details В отличие от присваивания через operator[], обновляет отпечаток словаря за O(1).
+     * @see get_fingerprint
+     */
+    void set_translation(const std::string& english_word, const std::string& russian_word);
+
     /**
      * @brief Оператор вывода словаря в поток
      * @param[out] output Выходной поток
@@ -55,6 +248,18 @@ public:
      */
     friend std::ostream& operator<<(std::ostream& output, const dictionary& dictionary);
 
+    /**
+     * @brief Быстрая выгрузка словаря в поток
+     * @param[out] output Выходной поток
+     * @param[in] format Формат выгрузки
+     * @return Количество выгруженных пар
+     * @details Строки собираются в большом буфере (числа форматируются через std::to_chars)
+     * и передаются в поток несколькими крупными блоками. Ошибка записи отражается
+     * в состоянии потока.
+     * @see operator<<
+     */
+    size_t export_to(std::ostream& output, export_format format = export_format::plain) const;
+
     /**
      * @brief Оператор ввода словаря из потока
      * @param[in] input Входной поток
@@ -94,7 +299,8 @@ public:
     /**
      * @brief Оператор сравнения словарей на равенство
      * @param[in] other Словарь для сравнения
-     * @return true если словари идентичны, false в противном случае
+     * @return true если словари содержат одинаковые пары слово-перевод, false в противном случае
+     * @details Сравнивается содержимое, а не форма деревьев.
      * @see operator!=
      */
     bool operator==(const dictionary& other) const;
@@ -107,6 +313,138 @@ public:
      */
     bool operator!=(const dictionary& other) const;
 
+    /**
+     * @brief Получение отпечатка содержимого словаря
+     * @return 64-битный отпечаток, не зависящий от порядка добавления слов
+     * @details Разные отпечатки гарантируют, что словари различаются; одинаковые отпечатки
+     * означают, что словари совпадают с высокой вероятностью. Подходит для определения,
+     * изменился ли словарь с момента последнего экспорта.
+     * @see binary_tree::get_fingerprint
+     */
+    uint64_t get_fingerprint() const;
+
+    /**
+     * @brief Построение списка различий с другим словарем
+     * @param[in] other Словарь, с которым выполняется сравнение
+     * @return Различия в порядке возрастания английских слов; их применение к текущему
+     * словарю дает other
+     * @details Оба дерева обходятся в порядке возрастания ключей одновременно, время O(n + m).
+     * @see apply_changes
+     */
+    std::vector<dictionary_change> diff(const dictionary& other) const;
+
+    /**
+     * @brief Применение списка различий к словарю
+     * @param[in] changes Различия, полученные через diff
+     * @return Ссылка на текущий объект словаря
+     * @details Различия применяются идемпотентно: added и changed записывают новый перевод,
+     * removed удаляет слово, если оно есть.
+     * @see diff
+     */
+    dictionary& apply_changes(const std::vector<dictionary_change>& changes);
+
+    /**
+     * @brief Объединение с другим словарем
+     * @param[in] other Добавляемый словарь
+     * @param[in] policy Правило выбора перевода для слов, которые есть в обоих словарях
+     * @return Ссылка на текущий объект словаря
+     * @details Объединение строится делением и соединением AVL-деревьев,
+     * время O(m log(n/m + 1)), где m <= n - размеры словарей.
+     * @see merge_policy
+     */
+    dictionary& merge(const dictionary& other, merge_policy policy = merge_policy::keep_own);
+
+    /**
+     * @brief Перенос слов из другого словаря без копирования
+     * @param[in,out] other Словарь-источник; в нем остаются только слова, которые уже есть в текущем
+     * @return Ссылка на текущий объект словаря
+     * @details Узлы дерева переставляются из одного словаря в другой без выделения памяти.
+     * @see binary_tree::merge
+     */
+    dictionary& splice(dictionary& other);
+
+    /**
+     * @brief Обмен содержимым с другим словарем за O(1)
+     * @param[in,out] other Словарь для обмена
+     */
+    void swap(dictionary& other) noexcept;
+
+    /**
+     * @brief Включение фильтра Блума перед деревом
+     * @param[in] false_positive_rate Допустимая доля ложных срабатываний (0; 1)
+     * @param[in] blocked Использовать блочный фильтр (одна строка кэша на проверку)
+     * @details Фильтр обновляется при добавлении слов и перестраивается, когда число слов
+     * превышает расчетное или после многих удалений, так как из фильтра Блума
+     * нельзя удалять.
+     * @see contains_word
+     */
+    void enable_key_filter(double false_positive_rate = 0.01, bool blocked = true);
+
+    /**
+     * @brief Отключение фильтра Блума
+     */
+    void disable_key_filter();
+
+    /**
+     * @brief Проверка, включен ли фильтр Блума
+     * @return true если фильтр включен
+     */
+    bool has_key_filter() const;
+
+    /**
+     * @brief Получение объема памяти фильтра Блума
+     * @return Размер битового массива в байтах, 0 если фильтр выключен
+     */
+    size_t get_key_filter_memory() const;
+
+    /**
+     * @brief Получение оценки занятой памяти
+     * @return Отчет по составляющим памяти и гистограмма длин слов
+     * @details Счетчики обновляются при добавлении, удалении, set_translation и apply_changes
+     * за O(log n), а число слов хранится в дереве. Вызов занимает O(h + p), где h - размер
+     * гистограммы, p - число пар, перевод которых выдан по ссылке через неконстантный
+     * operator[]. Метод не изменяет словарь и безопасен при одновременных вызовах.
+     * @see memory_usage_report
+     */
+    memory_usage_report memory_usage() const;
+
+    /**
+     * @brief Обход словаря в порядке возрастания английских слов
+     * @tparam function Тип функции вида void(const std::string&, const std::string&)
+     * @param[in] function_ Функция, вызываемая для каждой пары слово-перевод
+     */
+    template<typename function>
+    void for_each_word(function function_) const {
+        dictionary_tree.inorder_traverse(function_);
+    }
+
+    /**
+     * @brief Параллельный обход словаря
+     * @tparam function Тип функции вида void(const std::string&, const std::string&)
+     * @param[in] function_ Функция, вызываемая одновременно из нескольких потоков
+     * @param[in] thread_number Количество потоков, 0 - по числу ядер
+     * @see binary_tree::parallel_for_each
+     */
+    template<typename function>
+    void parallel_for_each(function function_, size_t thread_number = 0) const {
+        dictionary_tree.parallel_for_each(function_, thread_number);
+    }
+
+    /**
+     * @brief Параллельная свертка словаря с объединением результатов в порядке слов
+     * @param[in] identity Начальное значение частичных результатов
+     * @param[in] accumulate Функция вида void(result_type&, const std::string&, const std::string&)
+     * @param[in] combine Функция вида result_type(result_type, const result_type&)
+     * @param[in] thread_number Количество потоков, 0 - по числу ядер
+     * @return Результат свертки
+     * @see binary_tree::parallel_reduce
+     */
+    template<typename result_type, typename accumulate_function, typename combine_function>
+    result_type parallel_reduce(const result_type& identity, accumulate_function accumulate,
+                                combine_function combine, size_t thread_number = 0) const {
+        return dictionary_tree.parallel_reduce(identity, accumulate, combine, thread_number);
+    }
+
     /**
      * @brief Получение количества слов в словаре
      * @return Количество пар слово-перевод в словаре
@@ -125,10 +463,21 @@ public:
      * @brief Чтение словаря из файла
      * @param[in] file_name Имя файла для чтения
      * @details Файл должен содержать пары "английское слово - русский перевод",
-     * разделенные переводом строки. Некорректные строки игнорируются.
+     * разделенные переводом строки. Английская часть может быть фразой из нескольких слов.
+     * Некорректные строки игнорируются.
      * @see operator>>
      */
     void read_from_file(const std::string& file_name);
+
+    /**
+     * @brief Запись словаря в файл
+     * @param[in] file_name Имя файла для записи
+     * @return true если файл записан, false если его не удалось открыть
+     * @details Каждая пара записывается отдельной строкой "английское слово - русский перевод"
+     * в порядке возрастания английских слов, поэтому файл читается обратно через read_from_file.
+     * @see read_from_file
+     */
+    bool write_to_file(const std::string& file_name) const;
 };
 
 #endif //SEM3_L1_PPOIS_DICTIONARY_H
\ No newline at end of file
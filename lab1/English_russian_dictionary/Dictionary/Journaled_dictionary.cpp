@@ -0,0 +1,121 @@
+#include "Journaled_dictionary.h"
+#include <stdexcept>
+#include <filesystem>
+#include <fstream>
+
+journaled_dictionary::journaled_dictionary(const std::string& snapshot_file, const std::string& journal_file,
+                                           size_t sync_batch_size, size_t checkpoint_threshold_)
+        : snapshot_file_name(snapshot_file), checkpoint_threshold(checkpoint_threshold_) {
+    load_snapshot();
+    journal = std::make_unique<write_ahead_log>(journal_file, sync_batch_size);
+    journal->replay([this](bool is_deleted, const std::string& english_word, const std::string& russian_word) {
+        bool is_present = current_dictionary.contains_word(english_word);
+        if (is_deleted) {
+            if (is_present) current_dictionary -= english_word;
+        } else if (is_present) {
+            current_dictionary.set_translation(english_word, russian_word);
+        } else {
+            current_dictionary += std::make_pair(english_word, russian_word);
+        }
+    });
+}
+
+void journaled_dictionary::load_snapshot() {
+    std::ifstream snapshot(snapshot_file_name, std::ios::binary);
+    if (!snapshot.is_open()) return;
+    std::string first_line;
+    std::getline(snapshot, first_line);
+    if (first_line.compare(0, 2, "P\t") != 0) {
+        snapshot.close();
+        current_dictionary.read_from_file(snapshot_file_name);
+        return;
+    }
+    snapshot.clear();
+    snapshot.seekg(0);
+    std::uintmax_t valid_bytes = 0;
+    auto add_word = [this](bool, const std::string& english_word, const std::string& russian_word) {
+        current_dictionary += std::make_pair(english_word, russian_word);
+    };
+    write_ahead_log::read_records(snapshot, add_word, valid_bytes);
+    if (valid_bytes != std::filesystem::file_size(snapshot_file_name)) {
+        throw std::runtime_error("Снимок " + snapshot_file_name + " поврежден");
+    }
+}
+
+void journaled_dictionary::checkpoint_if_needed() {
+    if (checkpoint_threshold && journal->get_record_number() >= checkpoint_threshold) checkpoint();
+}
+
+bool journaled_dictionary::contains_word(const std::string& english_word) const {
+    return current_dictionary.contains_word(english_word);
+}
+
+const std::string& journaled_dictionary::operator[](const std::string& english_word) const {
+    return current_dictionary[english_word];
+}
+
+journaled_dictionary& journaled_dictionary::operator+=(const std::pair<std::string, std::string>& english_russian_pair) {
+    current_dictionary += english_russian_pair;
+    try {
+        journal->append_put(english_russian_pair.first, english_russian_pair.second);
+    } catch (...) {
+        current_dictionary -= english_russian_pair.first;
+        throw;
+    }
+    checkpoint_if_needed();
+    return *this;
+}
+
+journaled_dictionary& journaled_dictionary::operator-=(const std::string& english_word) {
+    std::string previous_translation = contains_word(english_word) ? (*this)[english_word] : std::string();
+    current_dictionary -= english_word;
+    try {
+        journal->append_delete(english_word);
+    } catch (...) {
+        current_dictionary += std::make_pair(english_word, previous_translation);
+        throw;
+    }
+    checkpoint_if_needed();
+    return *this;
+}
+
+void journaled_dictionary::set_translation(const std::string& english_word, const std::string& russian_word) {
+    std::string previous_translation = contains_word(english_word) ? (*this)[english_word] : std::string();
+    current_dictionary.set_translation(english_word, russian_word);
+    try {
+        journal->append_put(english_word, russian_word);
+    } catch (...) {
+        current_dictionary.set_translation(english_word, previous_translation);
+        throw;
+    }
+    checkpoint_if_needed();
+}
+
+void journaled_dictionary::sync() {
+    journal->sync();
+}
+
+void journaled_dictionary::checkpoint() {
+    std::string temporary_name = snapshot_file_name + ".tmp";
+    std::ofstream snapshot(temporary_name, std::ios::binary | std::ios::trunc);
+    current_dictionary.for_each_word([&snapshot](const std::string& english_word, const std::string& russian_word) {
+        snapshot << write_ahead_log::put_record(english_word, russian_word);
+    });
+    snapshot.close();
+    if (snapshot.fail()) {
+        throw std::runtime_error("Не удалось записать снимок " + snapshot_file_name);
+    }
+    write_ahead_log::sync_file(temporary_name);
+    std::filesystem::rename(temporary_name, snapshot_file_name);
+    std::filesystem::path snapshot_directory = std::filesystem::absolute(snapshot_file_name).parent_path();
+    write_ahead_log::sync_directory(snapshot_directory.string());
+    journal->truncate();
+}
+
+size_t journaled_dictionary::get_journal_length() const {
+    return journal->get_record_number();
+}
+
+const dictionary& journaled_dictionary::get_dictionary() const {
+    return current_dictionary;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file Journaled_dictionary.h
+ * @author Ященко Александра
+ * @brief Заголовочный файл словаря с журналом изменений.
+ */
+
+#ifndef SEM3_L1_PPOIS_JOURNALED_DICTIONARY_H
+#define SEM3_L1_PPOIS_JOURNALED_DICTIONARY_H
+
+#include <string>
+#include <memory>
+#include "Dictionary.h"
+#include "Write_ahead_log.h"
+
+/**
+ * @class journaled_dictionary
+ * @brief Словарь, сохраняющий каждое изменение без перезаписи всего файла.
+ * @details Состояние словаря складывается из снимка и журнала изменений с контрольными
+ * суммами. Снимок хранится в формате записей журнала, поэтому слова и переводы
+ * сохраняются без изменений и проверки; снимок в формате read_from_file, записанный
+ * прежними версиями, тоже читается. Изменения дописываются в журнал,
+ * который сбрасывается на диск группами. Когда журнал становится длиннее
+ * checkpoint_threshold записей, словарь записывает новый снимок и очищает журнал.
+ * Если запись в журнал не удалась, изменение в памяти отменяется, и словарь
+ * остается равным тому, что восстановится из снимка и журнала.
+ *
+ * Перевод меняется через set_translation, а не через присваивание operator[],
+ * так как запись по ссылке не может быть отражена в журнале.
+ *
+ * @see dictionary
+ * @see write_ahead_log
+ */
+class journaled_dictionary {
+private:
+    std::string snapshot_file_name; ///< Имя файла снимка
+    dictionary current_dictionary; ///< Текущее содержимое словаря
+    std::unique_ptr<write_ahead_log> journal; ///< Журнал изменений после снимка
+    size_t checkpoint_threshold; ///< Длина журнала, при которой создается снимок, 0 - только вручную
+
+    /**
+     * @brief Загружает снимок в current_dictionary.
+     * @throw std::runtime_error если снимок поврежден.
+     */
+    void load_snapshot();
+
+    /**
+     * @brief Создает снимок, если журнал достиг предельной длины.
+     */
+    void checkpoint_if_needed();
+
+public:
+    /**
+     * @brief Конструктор. Загружает снимок и воспроизводит журнал.
+     * @param snapshot_file Имя файла снимка.
+     * @param journal_file Имя файла журнала.
+     * @param sync_batch_size Количество записей в группе для fsync (1 - после каждой записи, 0 - никогда).
+     * @param checkpoint_threshold_ Длина журнала, при которой автоматически создается снимок.
+     * @throw std::runtime_error если журнал не удалось открыть или снимок поврежден.
+     */
+    journaled_dictionary(const std::string& snapshot_file, const std::string& journal_file,
+                         size_t sync_batch_size = 64, size_t checkpoint_threshold_ = 100000);
+
+    /**
+     * @brief Проверяет наличие слова в словаре.
+     * @param english_word Английское слово для поиска.
+     * @return true если слово найдено, false в противном случае.
+     */
+    bool contains_word(const std::string& english_word) const;
+
+    /**
+     * @brief Получение перевода слова.
+     * @param english_word Английское слово.
+     * @return Константная ссылка на перевод.
+     * @throw std::out_of_range если слова нет в словаре.
+     */
+    const std::string& operator[](const std::string& english_word) const;
+
+    /**
+     * @brief Добавление пары слово-перевод с записью в журнал.
+     * @param english_russian_pair Пара "английское слово - русский перевод".
+     * @return Ссылка на текущий объект.
+     * @throw std::invalid_argument если слово уже существует в словаре.
+     * @throw std::runtime_error если не удалось записать журнал; словарь при этом не меняется.
+     */
+    journaled_dictionary& operator+=(const std::pair<std::string, std::string>& english_russian_pair);
+
+    /**
+     * @brief Удаление слова с записью в журнал.
+     * @param english_word Английское слово для удаления.
+     * @return Ссылка на текущий объект.
+     * @throw std::invalid_argument если слова нет в словаре.
+     * @throw std::runtime_error если не удалось записать журнал; словарь при этом не меняется.
+     */
+    journaled_dictionary& operator-=(const std::string& english_word);
+
+    /**
+     * @brief Изменение перевода с записью в журнал.
+     * @param english_word Английское слово.
+     * @param russian_word Новый перевод.
+     * @throw std::out_of_range если слова нет в словаре.
+     * @throw std::runtime_error если не удалось записать журнал; словарь при этом не меняется.
+     */
+    void set_translation(const std::string& english_word, const std::string& russian_word);
+
+    /**
+     * @brief Сбрасывает на диск все записи журнала.
+     */
+    void sync();
+
+    /**
+     * @brief Записывает новый снимок и очищает журнал.
+     * @throw std::runtime_error если снимок не удалось записать или сбросить на диск.
+     * @details Журнал очищается только после того, как снимок и запись каталога о нем сброшены на диск.
+     */
+    void checkpoint();
+
+    /**
+     * @brief Получение количества записей в журнале.
+     * @return Количество записей после последнего снимка.
+     */
+    size_t get_journal_length() const;
+
+    /**
+     * @brief Получение текущего содержимого словаря.
+     * @return Константная ссылка на словарь.
+     */
+    const dictionary& get_dictionary() const;
+};
+
+#endif //SEM3_L1_PPOIS_JOURNALED_DICTIONARY_H
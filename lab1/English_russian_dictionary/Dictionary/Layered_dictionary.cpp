@@ -0,0 +1,64 @@
+#include "Layered_dictionary.h"
+#include <stdexcept>
+
+layered_dictionary::layered_dictionary(static_vocabulary core_words_) : core_words(core_words_) {}
+
+bool layered_dictionary::core_contains(const std::string& english_word) const {
+    return core_words.contains_word(english_word) && !removed_core_words.contains_node(english_word);
+}
+
+bool layered_dictionary::contains_word(const std::string& english_word) const {
+    return user_words.contains_word(english_word) || core_contains(english_word);
+}
+
+std::string layered_dictionary::operator[](const std::string& english_word) const {
+    if (user_words.contains_word(english_word)) return user_words[english_word];
+    if (!core_contains(english_word)) throw std::out_of_range("Ключ не найден.");
+    return std::string(core_words[english_word]);
+}
+
+layered_dictionary& layered_dictionary::operator+=(const std::pair<std::string, std::string>& english_russian_pair) {
+    if (core_contains(english_russian_pair.first)) {
+        throw std::invalid_argument("Слово уже существует в словаре");
+    }
+    user_words += english_russian_pair;
+    return *this;
+}
+
+layered_dictionary& layered_dictionary::operator-=(const std::string& english_word) {
+    bool in_user_words = user_words.contains_word(english_word);
+    bool in_core_words = core_contains(english_word);
+    if (!in_user_words && !in_core_words) {
+        throw std::invalid_argument("Слова не существует в словаре");
+    }
+    if (in_user_words) user_words -= english_word;
+    if (in_core_words) removed_core_words.insert_helper(english_word, true);
+    return *this;
+}
+
+void layered_dictionary::set_translation(const std::string& english_word, const std::string& russian_word) {
+    if (user_words.contains_word(english_word)) {
+        user_words.set_translation(english_word, russian_word);
+    } else if (core_contains(english_word)) {
+        user_words += std::make_pair(english_word, russian_word);
+    } else {
+        throw std::out_of_range("Ключ не найден.");
+    }
+}
+
+int layered_dictionary::get_size() const {
+    int size = user_words.get_size();
+    core_words.for_each_word([this, &size](std::string_view english_word, std::string_view) {
+        std::string word(english_word);
+        if (!removed_core_words.contains_node(word) && !user_words.contains_word(word)) size++;
+    });
+    return size;
+}
+
+bool layered_dictionary::is_empty() const {
+    return get_size() == 0;
+}
+
+const dictionary& layered_dictionary::get_user_words() const {
+    return user_words;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file Layered_dictionary.h
+ * @author Ященко Александра
+ * @brief Заголовочный файл словаря из встроенного и пользовательского слоев.
+ */
+
+#ifndef SEM3_L1_PPOIS_LAYERED_DICTIONARY_H
+#define SEM3_L1_PPOIS_LAYERED_DICTIONARY_H
+
+#include <string>
+#include "Dictionary.h"
+#include "Static_dictionary.h"
+
+/**
+ * @class layered_dictionary
+ * @brief Словарь, в котором пользовательские изменения лежат поверх встроенного словаря.
+ * @details Встроенный слой (например, core_vocabulary) не копируется и не изменяется.
+ * Добавленные и измененные слова хранятся в обычном dictionary и закрывают
+ * одноименные встроенные слова. Удаленные встроенные слова запоминаются
+ * в отдельном дереве.
+ *
+ * @see static_dictionary
+ * @see dictionary
+ */
+class layered_dictionary {
+private:
+    static_vocabulary core_words; ///< Встроенный неизменяемый слой
+    dictionary user_words; ///< Добавленные и измененные пользователем слова
+    binary_tree<std::string, bool> removed_core_words; ///< Удаленные встроенные слова
+
+    /**
+     * @brief Проверяет, видно ли встроенное слово.
+     * @param english_word Английское слово.
+     * @return true если слово есть во встроенном слое и не удалено.
+     */
+    bool core_contains(const std::string& english_word) const;
+
+public:
+    /**
+     * @brief Конструктор.
+     * @param core_words_ Встроенный слой, должен существовать все время жизни объекта.
+     */
+    explicit layered_dictionary(static_vocabulary core_words_);
+
+    /**
+     * @brief Проверяет наличие слова в любом слое.
+     * @param english_word Английское слово для поиска.
+     * @return true если слово найдено, false в противном случае.
+     */
+    bool contains_word(const std::string& english_word) const;
+
+    /**
+     * @brief Получение перевода слова.
+     * @param english_word Английское слово.
+     * @return Перевод из пользовательского слоя, а если его там нет - из встроенного.
+     * @throw std::out_of_range если слова нет в словаре.
+     */
+    std::string operator[](const std::string& english_word) const;
+
+    /**
+     * @brief Добавление пары слово-перевод в пользовательский слой.
+     * @param english_russian_pair Пара "английское слово - русский перевод".
+     * @return Ссылка на текущий объект.
+     * @throw std::invalid_argument если слово уже существует в словаре.
+     */
+    layered_dictionary& operator+=(const std::pair<std::string, std::string>& english_russian_pair);
+
+    /**
+     * @brief Удаление слова из всех слоев.
+     * @param english_word Английское слово для удаления.
+     * @return Ссылка на текущий объект.
+     * @throw std::invalid_argument если слова нет в словаре.
+     */
+    layered_dictionary& operator-=(const std::string& english_word);
+
+    /**
+     * @brief Изменение перевода; для встроенного слова перевод записывается в пользовательский слой.
+     * @param english_word Английское слово.
+     * @param russian_word Новый перевод.
+     * @throw std::out_of_range если слова нет в словаре.
+     */
+    void set_translation(const std::string& english_word, const std::string& russian_word);
+
+    /**
+     * @brief Получение количества видимых слов.
+     * @return Количество различных слов в обоих слоях.
+     * @details Время O(k log n), где k - размер встроенного слоя.
+     */
+    int get_size() const;
+
+    /**
+     * @brief Проверка пустоты словаря.
+     * @return true если в обоих слоях нет видимых слов.
+     */
+    bool is_empty() const;
+
+    /**
+     * @brief Получение пользовательского слоя.
+     * @return Константная ссылка на словарь пользовательских изменений.
+     */
+    const dictionary& get_user_words() const;
+};
+
+#endif //SEM3_L1_PPOIS_LAYERED_DICTIONARY_H
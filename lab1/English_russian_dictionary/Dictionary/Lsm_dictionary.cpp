@@ -0,0 +1,304 @@
+#include "Lsm_dictionary.h"
+#include <fstream>
+#include <algorithm>
+#include <stdexcept>
+#include <filesystem>
+#include <utility>
+
+const lsm_dictionary::lsm_record* lsm_dictionary::sorted_run::find(const std::string& english_word) const {
+    if (!run_filter.possibly_contains(english_word)) return nullptr;
+    auto position = std::lower_bound(run_entries.begin(), run_entries.end(), english_word,
+                                     [](const std::pair<std::string, lsm_record>& entry, const std::string& key) {
+                                         return entry.first < key;
+                                     });
+    if (position == run_entries.end() || position->first != english_word) return nullptr;
+    return &position->second;
+}
+
+lsm_dictionary::lsm_dictionary(const std::string& directory, size_t memtable_limit_, size_t compaction_trigger_,
+                               size_t sync_batch_size)
+        : directory_name(directory), memtable_limit(std::max<size_t>(1, memtable_limit_)),
+          compaction_trigger(std::max<size_t>(2, compaction_trigger_)), memtable_entries(0),
+          next_run_number(0), compaction_running(false), compaction_requested(false), stop_requested(false) {
+    std::error_code error;
+    std::filesystem::create_directories(directory_name, error);
+    if (!std::filesystem::is_directory(directory_name)) {
+        throw std::runtime_error("Не удалось открыть каталог " + directory_name);
+    }
+    memtable_log = std::make_unique<write_ahead_log>(path_to("wal.log"), sync_batch_size);
+    recover();
+    compaction_thread = std::thread(&lsm_dictionary::compaction_loop, this);
+}
+
+lsm_dictionary::~lsm_dictionary() {
+    {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        stop_requested = true;
+    }
+    compaction_signal.notify_all();
+    if (compaction_thread.joinable()) compaction_thread.join();
+}
+
+std::string lsm_dictionary::path_to(const std::string& file_name) const {
+    return (std::filesystem::path(directory_name) / file_name).string();
+}
+
+const lsm_dictionary::lsm_record* lsm_dictionary::find_record(const std::string& english_word) const {
+    if (memtable.contains_node(english_word)) return &memtable.get_value(english_word);
+    for (auto run = runs.rbegin(); run != runs.rend(); ++run) {
+        const lsm_record* record = (*run)->find(english_word);
+        if (record) return record;
+    }
+    return nullptr;
+}
+
+void lsm_dictionary::apply_to_memtable(const std::string& english_word, const lsm_record& record) {
+    if (record.is_deleted) memtable_log->append_delete(english_word);
+    else memtable_log->append_put(english_word, record.russian_word);
+    if (memtable.contains_node(english_word)) {
+        memtable.set_value(english_word, record);
+    } else {
+        memtable.insert_helper(english_word, record);
+        memtable_entries++;
+    }
+    flush_if_needed();
+}
+
+void lsm_dictionary::flush_if_needed() {
+    if (memtable_entries >= memtable_limit) flush_memtable();
+}
+
+void lsm_dictionary::flush_memtable() {
+    if (memtable_entries == 0) return;
+    auto run = std::make_shared<sorted_run>();
+    run->file_name = path_to("run_" + std::to_string(next_run_number++) + ".txt");
+    run->run_entries.reserve(memtable_entries);
+    run->run_filter = bloom_filter(memtable_entries);
+    memtable.inorder_traverse([&run](const std::string& english_word, const lsm_record& record) {
+        run->run_entries.emplace_back(english_word, record);
+        run->run_filter.add(english_word);
+    });
+    write_run(*run);
+    runs.push_back(run);
+    write_manifest();
+    memtable_log->truncate();
+    memtable = binary_tree<std::string, lsm_record>();
+    memtable_entries = 0;
+    if (runs.size() >= compaction_trigger) compaction_signal.notify_all();
+}
+
+void lsm_dictionary::write_run(const sorted_run& run) {
+    std::string temporary_name = run.file_name + ".tmp";
+    {
+        std::ofstream output(temporary_name, std::ios::binary | std::ios::trunc);
+        for (const auto& [english_word, record] : run.run_entries) {
+            if (record.is_deleted) output << write_ahead_log::delete_record(english_word);
+            else output << write_ahead_log::put_record(english_word, record.russian_word);
+        }
+        if (!output.flush()) throw std::runtime_error("Не удалось записать " + run.file_name);
+    }
+    write_ahead_log::sync_file(temporary_name);
+    std::filesystem::rename(temporary_name, run.file_name);
+}
+
+lsm_dictionary::run_pointer lsm_dictionary::load_run(const std::string& file_name) {
+    auto run = std::make_shared<sorted_run>();
+    run->file_name = file_name;
+    std::ifstream input(file_name, std::ios::binary);
+    if (!input.is_open()) throw std::runtime_error("Не удалось открыть " + file_name);
+    std::uintmax_t valid_bytes = 0;
+    write_ahead_log::read_records(input,
+            [&run](bool is_deleted, const std::string& english_word, const std::string& russian_word) {
+                if (!run->run_entries.empty() && !(run->run_entries.back().first < english_word)) {
+                    throw std::runtime_error("Нарушен порядок ключей в " + run->file_name);
+                }
+                run->run_entries.push_back({english_word, {russian_word, is_deleted}});
+            }, valid_bytes);
+    input.close();
+    if (valid_bytes != std::filesystem::file_size(file_name)) {
+        throw std::runtime_error("Run-файл " + file_name + " поврежден");
+    }
+    run->run_filter = bloom_filter(run->run_entries.size());
+    for (const auto& entry : run->run_entries) run->run_filter.add(entry.first);
+    return run;
+}
+
+void lsm_dictionary::write_manifest() const {
+    std::string manifest_name = path_to("MANIFEST");
+    std::string temporary_name = manifest_name + ".tmp";
+    {
+        std::ofstream output(temporary_name, std::ios::binary | std::ios::trunc);
+        output << next_run_number << '\n';
+        for (const run_pointer& run : runs) {
+            output << std::filesystem::path(run->file_name).filename().string() << '\n';
+        }
+        if (!output.flush()) throw std::runtime_error("Не удалось записать " + manifest_name);
+    }
+    write_ahead_log::sync_file(temporary_name);
+    std::filesystem::rename(temporary_name, manifest_name);
+    write_ahead_log::sync_directory(directory_name);
+}
+
+void lsm_dictionary::recover() {
+    std::ifstream manifest(path_to("MANIFEST"));
+    if (manifest.is_open()) {
+        std::string current_line;
+        if (std::getline(manifest, current_line)) next_run_number = std::stoul(current_line);
+        while (std::getline(manifest, current_line)) {
+            if (!current_line.empty()) runs.push_back(load_run(path_to(current_line)));
+        }
+    }
+    memtable_log->replay(
+            [this](bool is_deleted, const std::string& english_word, const std::string& russian_word) {
+                lsm_record record{russian_word, is_deleted};
+                if (memtable.contains_node(english_word)) {
+                    memtable.set_value(english_word, record);
+                } else {
+                    memtable.insert_helper(english_word, record);
+                    memtable_entries++;
+                }
+            });
+}
+
+lsm_dictionary::run_pointer lsm_dictionary::merge_runs(const std::vector<run_pointer>& runs_to_merge,
+                                                       const std::string& file_name) {
+    binary_tree<std::string, lsm_record> newest_records;
+    for (auto run = runs_to_merge.rbegin(); run != runs_to_merge.rend(); ++run) {
+        for (const auto& [english_word, record] : (*run)->run_entries) {
+            newest_records.insert_helper(english_word, record);
+        }
+    }
+    auto merged = std::make_shared<sorted_run>();
+    merged->file_name = file_name;
+    newest_records.inorder_traverse([&merged](const std::string& english_word, const lsm_record& record) {
+        if (!record.is_deleted) merged->run_entries.emplace_back(english_word, record);
+    });
+    merged->run_filter = bloom_filter(merged->run_entries.size());
+    for (const auto& entry : merged->run_entries) merged->run_filter.add(entry.first);
+    write_run(*merged);
+    return merged;
+}
+
+void lsm_dictionary::rethrow_compaction_error() {
+    if (compaction_error) std::rethrow_exception(std::exchange(compaction_error, nullptr));
+}
+
+void lsm_dictionary::compaction_loop() {
+    std::unique_lock<std::mutex> lock(state_mutex);
+    while (true) {
+        compaction_signal.wait(lock, [this] {
+            return stop_requested || compaction_requested || (!compaction_error && runs.size() >= compaction_trigger);
+        });
+        if (stop_requested) break;
+        if (runs.size() < 2) {
+            compaction_requested = false;
+            compaction_done.notify_all();
+            continue;
+        }
+        compaction_running = true;
+        std::vector<run_pointer> runs_to_merge = runs;
+        std::string file_name = path_to("run_" + std::to_string(next_run_number++) + ".txt");
+        lock.unlock();
+        try {
+            run_pointer merged = merge_runs(runs_to_merge, file_name);
+            lock.lock();
+            runs.erase(runs.begin(), runs.begin() + static_cast<std::ptrdiff_t>(runs_to_merge.size()));
+            runs.insert(runs.begin(), merged);
+            write_manifest();
+            for (const run_pointer& run : runs_to_merge) {
+                std::error_code error;
+                std::filesystem::remove(run->file_name, error);
+            }
+        } catch (...) {
+            if (!lock.owns_lock()) lock.lock();
+            compaction_error = std::current_exception();
+        }
+        compaction_running = false;
+        compaction_requested = false;
+        compaction_done.notify_all();
+    }
+}
+
+bool lsm_dictionary::contains_word(const std::string& english_word) const {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    const lsm_record* record = find_record(english_word);
+    return record && !record->is_deleted;
+}
+
+std::string lsm_dictionary::operator[](const std::string& english_word) const {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    const lsm_record* record = find_record(english_word);
+    if (!record || record->is_deleted) throw std::out_of_range("Ключ не найден.");
+    return record->russian_word;
+}
+
+lsm_dictionary& lsm_dictionary::operator+=(const std::pair<std::string, std::string>& english_russian_pair) {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    rethrow_compaction_error();
+    const lsm_record* record = find_record(english_russian_pair.first);
+    if (record && !record->is_deleted) {
+        throw std::invalid_argument("Слово уже существует в словаре");
+    }
+    apply_to_memtable(english_russian_pair.first, {english_russian_pair.second, false});
+    return *this;
+}
+
+lsm_dictionary& lsm_dictionary::operator-=(const std::string& english_word) {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    rethrow_compaction_error();
+    const lsm_record* record = find_record(english_word);
+    if (!record || record->is_deleted) {
+        throw std::invalid_argument("Слова не существует в словаре");
+    }
+    apply_to_memtable(english_word, {"", true});
+    return *this;
+}
+
+void lsm_dictionary::set_translation(const std::string& english_word, const std::string& russian_word) {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    rethrow_compaction_error();
+    const lsm_record* record = find_record(english_word);
+    if (!record || record->is_deleted) throw std::out_of_range("Ключ не найден.");
+    apply_to_memtable(english_word, {russian_word, false});
+}
+
+void lsm_dictionary::flush() {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    rethrow_compaction_error();
+    flush_memtable();
+}
+
+void lsm_dictionary::compact() {
+    std::unique_lock<std::mutex> lock(state_mutex);
+    rethrow_compaction_error();
+    while (runs.size() > 1) {
+        compaction_requested = true;
+        compaction_signal.notify_all();
+        compaction_done.wait(lock, [this] { return !compaction_requested && !compaction_running; });
+        rethrow_compaction_error();
+    }
+}
+
+size_t lsm_dictionary::get_run_count() const {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    return runs.size();
+}
+
+int lsm_dictionary::get_size() const {
+    return to_dictionary().get_size();
+}
+
+dictionary lsm_dictionary::to_dictionary() const {
+    std::lock_guard<std::mutex> lock(state_mutex);
+    binary_tree<std::string, lsm_record> newest_records = memtable;
+    for (auto run = runs.rbegin(); run != runs.rend(); ++run) {
+        for (const auto& [english_word, record] : (*run)->run_entries) {
+            newest_records.insert_helper(english_word, record);
+        }
+    }
+    dictionary result;
+    newest_records.inorder_traverse([&result](const std::string& english_word, const lsm_record& record) {
+        if (!record.is_deleted) result += std::make_pair(english_word, record.russian_word);
+    });
+    return result;
+}
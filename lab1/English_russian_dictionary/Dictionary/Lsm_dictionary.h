@@ -0,0 +1,263 @@
+/**
+ * @file Lsm_dictionary.h
+ * @author Ященко Александра
+ * @brief Заголовочный файл словаря с журналированной структурой (LSM).
+ */
+
+#ifndef SEM3_L1_PPOIS_LSM_DICTIONARY_H
+#define SEM3_L1_PPOIS_LSM_DICTIONARY_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <exception>
+#include "Binary_tree.h"
+#include "Bloom_filter.h"
+#include "Write_ahead_log.h"
+#include "Dictionary.h"
+
+/**
+ * @class lsm_dictionary
+ * @brief Словарь, оптимизированный для частых изменений с сохранением на диск.
+ * @details Изменения попадают в AVL-дерево в памяти (memtable) и в журнал упреждающей
+ * записи. Когда memtable достигает заданного размера, она сбрасывается на диск в виде
+ * неизменяемого отсортированного файла (run). Поиск просматривает memtable и затем
+ * run-файлы от новых к старым, пропуская те, чей фильтр Блума не содержит ключа.
+ * Фоновый поток сливает run-файлы в один, когда их становится слишком много.
+ *
+ * Список актуальных run-файлов хранится в файле MANIFEST, который перезаписывается
+ * атомарно. Run-файл и MANIFEST сбрасываются на диск до переименования, а каталог -
+ * после него, поэтому журнал очищается только тогда, когда новый run уже надежно
+ * сохранен. После сбоя словарь восстанавливается из MANIFEST и журнала.
+ *
+ * Ошибка фонового слияния не завершает программу: она запоминается и выбрасывается
+ * из следующего вызова, изменяющего словарь, или из compact().
+ *
+ * @see dictionary
+ * @see write_ahead_log
+ */
+class lsm_dictionary {
+private:
+    /**
+     * @struct lsm_record
+     * @brief Значение в memtable и run-файле: перевод или отметка об удалении.
+     */
+    struct lsm_record {
+        std::string russian_word; ///< Перевод
+        bool is_deleted; ///< Отметка об удалении (tombstone)
+    };
+
+    /**
+     * @struct sorted_run
+     * @brief Неизменяемый отсортированный набор записей, сохраненный в файле.
+     */
+    struct sorted_run {
+        std::string file_name; ///< Имя файла run
+        std::vector<std::pair<std::string, lsm_record>> run_entries; ///< Записи в порядке возрастания ключей
+        bloom_filter run_filter; ///< Фильтр Блума по ключам run
+
+        /**
+         * @brief Ищет запись в run.
+         * @param english_word Ключ для поиска.
+         * @return Указатель на запись или nullptr.
+         */
+        const lsm_record* find(const std::string& english_word) const;
+    };
+
+    using run_pointer = std::shared_ptr<const sorted_run>; ///< Разделяемый указатель на run
+
+    std::string directory_name; ///< Каталог с файлами словаря
+    size_t memtable_limit; ///< Количество записей memtable, при котором она сбрасывается на диск
+    size_t compaction_trigger; ///< Количество run-файлов, при котором запускается слияние
+
+    binary_tree<std::string, lsm_record> memtable; ///< Дерево последних изменений
+    size_t memtable_entries; ///< Количество записей в memtable
+    std::unique_ptr<write_ahead_log> memtable_log; ///< Журнал изменений memtable
+    std::vector<run_pointer> runs; ///< Run-файлы от старых к новым
+    size_t next_run_number; ///< Номер следующего run-файла
+
+    mutable std::mutex state_mutex; ///< Защищает memtable, runs и MANIFEST
+    std::condition_variable compaction_signal; ///< Пробуждает поток слияния
+    std::condition_variable compaction_done; ///< Сообщает о завершении слияния
+    bool compaction_running; ///< Идет ли слияние
+    bool compaction_requested; ///< Запрошено ли принудительное слияние
+    bool stop_requested; ///< Запрошена ли остановка потока слияния
+    std::exception_ptr compaction_error; ///< Ошибка последнего слияния, еще не переданная вызывающему
+    std::thread compaction_thread; ///< Фоновый поток слияния
+
+    /**
+     * @brief Формирует полный путь к файлу в каталоге словаря.
+     * @param file_name Имя файла.
+     * @return Путь к файлу.
+     */
+    std::string path_to(const std::string& file_name) const;
+
+    /**
+     * @brief Ищет запись по всем уровням без блокировки.
+     * @param english_word Ключ для поиска.
+     * @return Указатель на актуальную запись или nullptr.
+     */
+    const lsm_record* find_record(const std::string& english_word) const;
+
+    /**
+     * @brief Записывает изменение в журнал и memtable.
+     * @param english_word Ключ.
+     * @param record Новая запись.
+     */
+    void apply_to_memtable(const std::string& english_word, const lsm_record& record);
+
+    /**
+     * @brief Сбрасывает memtable на диск, если она достигла предельного размера.
+     */
+    void flush_if_needed();
+
+    /**
+     * @brief Сбрасывает memtable в новый run-файл без блокировки.
+     */
+    void flush_memtable();
+
+    /**
+     * @brief Записывает run-файл на диск.
+     * @param run Run для записи.
+     * @details Записи хранятся в формате write_ahead_log: поля экранированы, каждая строка
+     *          снабжена контрольной суммой.
+     */
+    static void write_run(const sorted_run& run);
+
+    /**
+     * @brief Загружает run-файл с диска.
+     * @param file_name Полный путь к файлу.
+     * @return Загруженный run.
+     * @throw std::runtime_error если файл не открывается, содержит поврежденную запись
+     *        или ключи идут не по возрастанию.
+     */
+    static run_pointer load_run(const std::string& file_name);
+
+    /**
+     * @brief Перезаписывает MANIFEST списком текущих run-файлов.
+     */
+    void write_manifest() const;
+
+    /**
+     * @brief Восстанавливает состояние из MANIFEST и журнала.
+     */
+    void recover();
+
+    /**
+     * @brief Сливает несколько run в один, отбрасывая устаревшие записи и удаления.
+     * @param runs_to_merge Run-файлы от старых к новым.
+     * @param file_name Имя файла результата.
+     * @return Слитый run.
+     */
+    static run_pointer merge_runs(const std::vector<run_pointer>& runs_to_merge, const std::string& file_name);
+
+    /**
+     * @brief Выбрасывает сохраненную ошибку фонового слияния и сбрасывает ее.
+     * @details Вызывается под блокировкой state_mutex.
+     */
+    void rethrow_compaction_error();
+
+    /**
+     * @brief Основной цикл фонового потока слияния.
+     * @details Исключения слияния перехватываются и сохраняются в compaction_error;
+     *          пока ошибка не передана вызывающему, автоматическое слияние не запускается.
+     */
+    void compaction_loop();
+
+public:
+    /**
+     * @brief Конструктор. Открывает словарь в каталоге, восстанавливая сохраненное состояние.
+     * @param directory Каталог для файлов словаря (создается при необходимости).
+     * @param memtable_limit_ Количество записей memtable, при котором она сбрасывается на диск.
+     * @param compaction_trigger_ Количество run-файлов, при котором запускается слияние.
+     * @param sync_batch_size Количество записей журнала в группе для fsync (1 - после каждой записи, 0 - никогда).
+     * @throw std::runtime_error если каталог или журнал не удалось открыть или run-файл поврежден.
+     */
+    explicit lsm_dictionary(const std::string& directory, size_t memtable_limit_ = 4096,
+                            size_t compaction_trigger_ = 4, size_t sync_batch_size = 64);
+
+    /**
+     * @brief Деструктор. Останавливает поток слияния.
+     * @details Memtable не сбрасывается: ее содержимое уже находится в журнале
+     *          и будет восстановлено при следующем открытии.
+     */
+    ~lsm_dictionary();
+
+    lsm_dictionary(const lsm_dictionary&) = delete;
+    lsm_dictionary& operator=(const lsm_dictionary&) = delete;
+
+    /**
+     * @brief Проверяет наличие слова в словаре.
+     * @param english_word Английское слово для поиска.
+     * @return true если слово найдено, false в противном случае.
+     */
+    bool contains_word(const std::string& english_word) const;
+
+    /**
+     * @brief Получение перевода слова.
+     * @param english_word Английское слово.
+     * @return Копия перевода.
+     * @throw std::out_of_range если слова нет в словаре.
+     */
+    std::string operator[](const std::string& english_word) const;
+
+    /**
+     * @brief Добавление пары слово-перевод.
+     * @param english_russian_pair Пара "английское слово - русский перевод".
+     * @return Ссылка на текущий объект словаря.
+     * @throw std::invalid_argument если слово уже существует в словаре.
+     */
+    lsm_dictionary& operator+=(const std::pair<std::string, std::string>& english_russian_pair);
+
+    /**
+     * @brief Удаление слова из словаря.
+     * @param english_word Английское слово для удаления.
+     * @return Ссылка на текущий объект словаря.
+     * @throw std::invalid_argument если слова нет в словаре.
+     */
+    lsm_dictionary& operator-=(const std::string& english_word);
+
+    /**
+     * @brief Изменение перевода существующего слова.
+     * @param english_word Английское слово.
+     * @param russian_word Новый перевод.
+     * @throw std::out_of_range если слова нет в словаре.
+     */
+    void set_translation(const std::string& english_word, const std::string& russian_word);
+
+    /**
+     * @brief Принудительно сбрасывает memtable на диск.
+     * @throw std::runtime_error если не удалось записать run-файл или завершить предыдущее слияние.
+     */
+    void flush();
+
+    /**
+     * @brief Сливает все run-файлы в один и дожидается завершения.
+     * @throw std::runtime_error если слияние завершилось ошибкой; run-файлы при этом остаются прежними.
+     */
+    void compact();
+
+    /**
+     * @brief Получение количества run-файлов.
+     * @return Количество run-файлов.
+     */
+    size_t get_run_count() const;
+
+    /**
+     * @brief Получение количества слов в словаре.
+     * @return Количество слов.
+     * @details Выполняется слиянием всех уровней, время O(n).
+     */
+    int get_size() const;
+
+    /**
+     * @brief Строит обычный словарь из текущего содержимого.
+     * @return Словарь со всеми актуальными парами.
+     */
+    dictionary to_dictionary() const;
+};
+
+#endif //SEM3_L1_PPOIS_LSM_DICTIONARY_H
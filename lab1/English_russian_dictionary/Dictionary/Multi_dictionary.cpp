@@ -0,0 +1,146 @@
+#include "Multi_dictionary.h"
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+#include "String_validator.h"
+
+bool multi_dictionary::contains_word(const std::string& english_word) const {
+    return dictionary_tree.contains_node(english_word);
+}
+
+const translation_list& multi_dictionary::operator[](const std::string& english_word) const {
+    return dictionary_tree.get_value(english_word);
+}
+
+bool multi_dictionary::add_translation(const std::string& english_word, const std::string& russian_word) {
+    return append_translations(english_word, {russian_word}) == 1;
+}
+
+size_t multi_dictionary::append_translations(const std::string& english_word,
+                                             const std::vector<std::string>& russian_words) {
+    if (russian_words.empty()) return 0;
+    size_t added = 0;
+    bool found = dictionary_tree.modify_value(english_word, [&russian_words, &added](translation_list& translations) {
+        for (const std::string& russian_word : russian_words) {
+            if (translations.append(russian_word)) added++;
+        }
+    });
+    if (!found) {
+        translation_list translations;
+        for (const std::string& russian_word : russian_words) {
+            if (translations.append(russian_word)) added++;
+        }
+        dictionary_tree.insert_helper(english_word, translations);
+    }
+    translation_number += added;
+    return added;
+}
+
+bool multi_dictionary::remove_translation(const std::string& english_word, const std::string& russian_word) {
+    bool removed = false;
+    bool now_empty = false;
+    dictionary_tree.modify_value(english_word, [&](translation_list& translations) {
+        removed = translations.remove(russian_word);
+        now_empty = translations.empty();
+    });
+    if (now_empty) dictionary_tree.delete_helper(english_word);
+    if (removed) translation_number--;
+    return removed;
+}
+
+multi_dictionary& multi_dictionary::operator+=(const std::pair<std::string, std::string>& english_russian_pair) {
+    if (!add_translation(english_russian_pair.first, english_russian_pair.second)) {
+        throw std::invalid_argument("Перевод уже существует в словаре");
+    }
+    return *this;
+}
+
+multi_dictionary& multi_dictionary::operator-=(const std::string& english_word) {
+    if (!dictionary_tree.contains_node(english_word)) throw std::invalid_argument("Слова не существует в словаре");
+    translation_number -= std::as_const(dictionary_tree).get_value(english_word).size();
+    dictionary_tree.delete_helper(english_word);
+    return *this;
+}
+
+std::ostream& operator<<(std::ostream& output, const multi_dictionary& dictionary_) {
+    size_t counter = 0;
+    dictionary_.for_each_word([&output, &counter](const std::string& english_word, const translation_list& translations) {
+        output << ++counter << ". " << english_word << " - ";
+        bool first = true;
+        translations.for_each([&output, &first](std::string_view russian_word) {
+            if (!first) output << ", ";
+            output << russian_word;
+            first = false;
+        });
+        output << "\n";
+    });
+    return output;
+}
+
+std::istream& operator>>(std::istream& input, multi_dictionary& dictionary_) {
+    std::string current_line;
+    while (std::getline(input, current_line)) {
+        if (!current_line.empty()) {
+            try {
+                std::pair<std::string, std::string> new_pair = string_validator::word_pair_input(current_line);
+                if (!new_pair.second.empty()) dictionary_.add_translation(new_pair.first, new_pair.second);
+            } catch (const std::invalid_argument& exception) {
+
+            }
+        }
+    }
+    return input;
+}
+
+bool multi_dictionary::operator==(const multi_dictionary& other) const {
+    if (translation_number != other.translation_number) return false;
+    return dictionary_tree == other.dictionary_tree;
+}
+
+bool multi_dictionary::operator!=(const multi_dictionary& other) const {
+    return !(*this == other);
+}
+
+uint64_t multi_dictionary::get_fingerprint() const {
+    return dictionary_tree.get_fingerprint();
+}
+
+int multi_dictionary::get_size() const {
+    return dictionary_tree.get_size();
+}
+
+size_t multi_dictionary::get_translation_number() const {
+    return translation_number;
+}
+
+bool multi_dictionary::is_empty() const {
+    return dictionary_tree.get_size() == 0;
+}
+
+void multi_dictionary::read_from_file(const std::string& file_name) {
+    std::ifstream txt_file(file_name);
+    if (txt_file.is_open()) {
+        txt_file >> *this;
+        txt_file.close();
+    }
+}
+
+bool multi_dictionary::write_to_file(const std::string& file_name) const {
+    std::ofstream txt_file(file_name, std::ios::binary | std::ios::trunc);
+    if (!txt_file.is_open()) return false;
+    for_each_word([&txt_file](const std::string& english_word, const translation_list& translations) {
+        translations.for_each([&txt_file, &english_word](std::string_view russian_word) {
+            txt_file << english_word << " - " << russian_word << '\n';
+        });
+    });
+    txt_file.close();
+    return !txt_file.fail();
+}
+
+dictionary multi_dictionary::to_dictionary() const {
+    dictionary result;
+    for_each_word([&result](const std::string& english_word, const translation_list& translations) {
+        result += std::make_pair(english_word, std::string(translations.primary()));
+    });
+    return result;
+}
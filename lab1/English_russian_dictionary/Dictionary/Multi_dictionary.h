@@ -0,0 +1,183 @@
+/**
+ * @file Multi_dictionary.h
+ * @author Ященко Александра
+ * @brief Заголовочный файл словаря с несколькими переводами у слова.
+ */
+
+#ifndef SEM3_L1_PPOIS_MULTI_DICTIONARY_H
+#define SEM3_L1_PPOIS_MULTI_DICTIONARY_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include "Binary_tree.h"
+#include "Dictionary.h"
+#include "Translation_list.h"
+
+/**
+ * @class multi_dictionary
+ * @brief Словарь, в котором английскому слову соответствует список переводов.
+ * @details В отличие от dictionary, повторная строка с тем же словом при чтении
+ * не отбрасывается, а добавляет альтернативный перевод. Переводы хранятся
+ * в translation_list и дописываются в существующий узел дерева без его пересоздания.
+ *
+ * Файл записывается по одной строке "слово - перевод" на каждый перевод, основной
+ * перевод идет первым. Поэтому dictionary::read_from_file читает такой файл
+ * и получает основные переводы.
+ *
+ * @see dictionary
+ * @see translation_list
+ */
+class multi_dictionary {
+private:
+    binary_tree<std::string, translation_list> dictionary_tree; ///< Дерево слов со списками переводов
+    size_t translation_number = 0; ///< Общее количество переводов
+
+public:
+    /**
+     * @brief Проверяет наличие слова в словаре.
+     * @param english_word Английское слово для поиска.
+     * @return true если слово найдено, false в противном случае.
+     */
+    bool contains_word(const std::string& english_word) const;
+
+    /**
+     * @brief Получение всех переводов слова.
+     * @param english_word Английское слово.
+     * @return Список переводов, первый из них основной.
+     * @throw std::out_of_range если слова нет в словаре.
+     */
+    const translation_list& operator[](const std::string& english_word) const;
+
+    /**
+     * @brief Добавление перевода слова.
+     * @param english_word Английское слово.
+     * @param russian_word Перевод.
+     * @return true если перевод добавлен, false если он уже был у слова.
+     * @details Если слова нет в словаре, оно добавляется с этим переводом как основным.
+     */
+    bool add_translation(const std::string& english_word, const std::string& russian_word);
+
+    /**
+     * @brief Добавление нескольких переводов слова за один поиск в дереве.
+     * @param english_word Английское слово.
+     * @param russian_words Переводы в порядке добавления.
+     * @return Количество добавленных переводов без учета повторов.
+     */
+    size_t append_translations(const std::string& english_word, const std::vector<std::string>& russian_words);
+
+    /**
+     * @brief Удаление одного перевода слова.
+     * @param english_word Английское слово.
+     * @param russian_word Перевод.
+     * @return true если перевод удален, false если его не было.
+     * @details Слово, у которого не осталось переводов, удаляется из словаря.
+     */
+    bool remove_translation(const std::string& english_word, const std::string& russian_word);
+
+    /**
+     * @brief Добавление пары слово-перевод.
+     * @param english_russian_pair Пара "английское слово - русский перевод".
+     * @return Ссылка на текущий объект.
+     * @throw std::invalid_argument если у слова уже есть такой перевод.
+     */
+    multi_dictionary& operator+=(const std::pair<std::string, std::string>& english_russian_pair);
+
+    /**
+     * @brief Удаление слова со всеми переводами.
+     * @param english_word Английское слово для удаления.
+     * @return Ссылка на текущий объект.
+     * @throw std::invalid_argument если слова нет в словаре.
+     */
+    multi_dictionary& operator-=(const std::string& english_word);
+
+    /**
+     * @brief Обход словаря в порядке возрастания английских слов.
+     * @tparam function Тип функции вида void(const std::string&, const translation_list&).
+     * @param function_ Функция, вызываемая для каждого слова.
+     */
+    template<typename function>
+    void for_each_word(function function_) const {
+        dictionary_tree.inorder_traverse(function_);
+    }
+
+    /**
+     * @brief Оператор вывода словаря в поток.
+     * @param output Выходной поток.
+     * @param dictionary_ Словарь для вывода.
+     * @return Ссылка на выходной поток.
+     * @details Формат строки: "1. слово - перевод, перевод".
+     */
+    friend std::ostream& operator<<(std::ostream& output, const multi_dictionary& dictionary_);
+
+    /**
+     * @brief Оператор ввода словаря из потока.
+     * @param input Входной поток.
+     * @param dictionary_ Словарь для заполнения.
+     * @return Ссылка на входной поток.
+     * @details Каждая строка "слово - перевод" добавляет перевод, повторы пропускаются.
+     */
+    friend std::istream& operator>>(std::istream& input, multi_dictionary& dictionary_);
+
+    /**
+     * @brief Оператор сравнения словарей на равенство.
+     * @param other Словарь для сравнения.
+     * @return true если у всех слов совпадают переводы и их порядок.
+     */
+    bool operator==(const multi_dictionary& other) const;
+
+    /**
+     * @brief Оператор сравнения словарей на неравенство.
+     * @param other Словарь для сравнения.
+     * @return true если словари различаются.
+     */
+    bool operator!=(const multi_dictionary& other) const;
+
+    /**
+     * @brief Получение отпечатка содержимого.
+     * @return Отпечаток дерева слов.
+     * @see binary_tree::get_fingerprint
+     */
+    uint64_t get_fingerprint() const;
+
+    /**
+     * @brief Получение количества слов в словаре.
+     * @return Количество английских слов.
+     */
+    int get_size() const;
+
+    /**
+     * @brief Получение количества переводов всех слов.
+     * @return Количество пар слово-перевод.
+     */
+    size_t get_translation_number() const;
+
+    /**
+     * @brief Проверка пустоты словаря.
+     * @return true если словарь пуст.
+     */
+    bool is_empty() const;
+
+    /**
+     * @brief Чтение словаря из файла.
+     * @param file_name Имя файла для чтения.
+     */
+    void read_from_file(const std::string& file_name);
+
+    /**
+     * @brief Запись словаря в файл, по строке на каждый перевод.
+     * @param file_name Имя файла для записи.
+     * @return true если файл записан, false если его не удалось открыть.
+     */
+    bool write_to_file(const std::string& file_name) const;
+
+    /**
+     * @brief Копирование основных переводов в обычный словарь.
+     * @return Словарь, в котором у каждого слова только основной перевод.
+     */
+    dictionary to_dictionary() const;
+};
+
+#endif //SEM3_L1_PPOIS_MULTI_DICTIONARY_H
@@ -0,0 +1,179 @@
+#include "Phrase_matcher.h"
+#include <stdexcept>
+#include <cctype>
+#include <algorithm>
+
+namespace {
+    bool is_word_symbol(char symbol) {
+        return std::isalpha(static_cast<unsigned char>(symbol)) || symbol == '\'' || symbol == '-';
+    }
+
+    char lower_ascii(char symbol) {
+        return (symbol >= 'A' && symbol <= 'Z') ? static_cast<char>(symbol + 32) : symbol;
+    }
+}
+
+phrase_matcher::phrase_matcher() : nodes(1), links_are_stale(false), phrase_number(0), longest_phrase(0),
+                                   source_fingerprint(0) {
+    root_children.fill(-1);
+}
+
+phrase_matcher::phrase_matcher(const dictionary& dictionary_) : phrase_matcher() {
+    rebuild(dictionary_);
+}
+
+int phrase_matcher::find_child(int node, char symbol) const {
+    if (node == 0) return root_children[static_cast<unsigned char>(symbol)];
+    for (const auto& [child_symbol, child] : nodes[node].children) {
+        if (child_symbol == symbol) return child;
+    }
+    return -1;
+}
+
+void phrase_matcher::build_links() const {
+    std::vector<int> queue;
+    queue.reserve(nodes.size());
+    nodes[0].failure_link = 0;
+    nodes[0].output_link = -1;
+    for (const auto& [symbol, child] : nodes[0].children) {
+        nodes[child].failure_link = 0;
+        nodes[child].output_link = -1;
+        queue.push_back(child);
+    }
+    for (size_t head = 0; head < queue.size(); ++head) {
+        int current = queue[head];
+        for (const auto& [symbol, child] : nodes[current].children) {
+            int fallback = nodes[current].failure_link;
+            int target = find_child(fallback, symbol);
+            while (target == -1 && fallback != 0) {
+                fallback = nodes[fallback].failure_link;
+                target = find_child(fallback, symbol);
+            }
+            int failure = (target == -1) ? 0 : target;
+            nodes[child].failure_link = failure;
+            nodes[child].output_link = nodes[failure].is_terminal ? failure : nodes[failure].output_link;
+            queue.push_back(child);
+        }
+    }
+    links_are_stale = false;
+}
+
+bool phrase_matcher::add_phrase(const std::string& english_phrase) {
+    if (english_phrase.empty()) throw std::invalid_argument("Пустая фраза");
+    int current = 0;
+    for (char symbol : english_phrase) {
+        int next = find_child(current, symbol);
+        if (next == -1) {
+            next = static_cast<int>(nodes.size());
+            trie_node new_node;
+            new_node.depth = nodes[current].depth + 1;
+            nodes.push_back(new_node);
+            nodes[current].children.emplace_back(symbol, next);
+            if (current == 0) root_children[static_cast<unsigned char>(symbol)] = next;
+            links_are_stale = true;
+        }
+        current = next;
+    }
+    if (nodes[current].is_terminal) return false;
+    nodes[current].is_terminal = true;
+    links_are_stale = true;
+    phrase_number++;
+    longest_phrase = std::max(longest_phrase, english_phrase.size());
+    return true;
+}
+
+bool phrase_matcher::remove_phrase(const std::string& english_phrase) {
+    int current = 0;
+    for (char symbol : english_phrase) {
+        current = find_child(current, symbol);
+        if (current == -1) return false;
+    }
+    if (current == 0 || !nodes[current].is_terminal) return false;
+    nodes[current].is_terminal = false;
+    links_are_stale = true;
+    phrase_number--;
+    return true;
+}
+
+void phrase_matcher::rebuild(const dictionary& dictionary_) {
+    nodes.assign(1, trie_node());
+    root_children.fill(-1);
+    phrase_number = 0;
+    longest_phrase = 0;
+    dictionary_.for_each_word([this](const std::string& english_word, const std::string&) {
+        add_phrase(english_word);
+    });
+    build_links();
+    source_fingerprint = dictionary_.get_fingerprint();
+}
+
+bool phrase_matcher::synchronize(const dictionary& dictionary_) {
+    if (dictionary_.get_fingerprint() == source_fingerprint) return false;
+    rebuild(dictionary_);
+    return true;
+}
+
+std::vector<phrase_match> phrase_matcher::find_all(const std::string& text) const {
+    if (links_are_stale) build_links();
+    std::vector<phrase_match> matches;
+    std::vector<size_t> fed_positions(longest_phrase + 1);
+    size_t fed_number = 0;
+    int state = 0;
+    bool previous_is_space = true;
+    for (size_t i = 0; i < text.size(); ++i) {
+        char symbol = lower_ascii(text[i]);
+        if (std::isspace(static_cast<unsigned char>(symbol))) {
+            if (previous_is_space) continue;
+            symbol = ' ';
+            previous_is_space = true;
+        } else {
+            previous_is_space = false;
+        }
+        fed_positions[fed_number++ % fed_positions.size()] = i;
+        int next = find_child(state, symbol);
+        while (next == -1 && state != 0) {
+            state = nodes[state].failure_link;
+            next = find_child(state, symbol);
+        }
+        state = (next == -1) ? 0 : next;
+
+        if (i + 1 < text.size() && is_word_symbol(text[i + 1])) continue;
+        for (int output = nodes[state].is_terminal ? state : nodes[state].output_link;
+             output != -1; output = nodes[output].output_link) {
+            size_t first_fed = fed_number - nodes[output].depth;
+            size_t start = fed_positions[first_fed % fed_positions.size()];
+            if (start > 0 && is_word_symbol(text[start - 1])) continue;
+            std::string english_phrase;
+            english_phrase.reserve(nodes[output].depth);
+            for (size_t j = first_fed; j < fed_number; ++j) {
+                char original = text[fed_positions[j % fed_positions.size()]];
+                english_phrase += std::isspace(static_cast<unsigned char>(original)) ? ' ' : lower_ascii(original);
+            }
+            matches.push_back({start, i + 1 - start, std::move(english_phrase)});
+        }
+    }
+    return matches;
+}
+
+std::vector<phrase_match> phrase_matcher::find_longest(const std::string& text) const {
+    std::vector<phrase_match> all_matches = find_all(text);
+    std::sort(all_matches.begin(), all_matches.end(), [](const phrase_match& first, const phrase_match& second) {
+        return first.position != second.position ? first.position < second.position : first.length > second.length;
+    });
+    std::vector<phrase_match> chosen;
+    size_t covered_until = 0;
+    for (phrase_match& match : all_matches) {
+        if (match.position < covered_until) continue;
+        covered_until = match.position + match.length;
+        chosen.push_back(std::move(match));
+    }
+    return chosen;
+}
+
+size_t phrase_matcher::get_phrase_number() const {
+    return phrase_number;
+}
+
+size_t phrase_matcher::get_state_number() const {
+    return nodes.size();
+}
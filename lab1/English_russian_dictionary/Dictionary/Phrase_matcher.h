@@ -0,0 +1,145 @@
+/**
+ * @file Phrase_matcher.h
+ * @author Ященко Александра
+ * @brief Заголовочный файл поиска словарных фраз в тексте.
+ */
+
+#ifndef SEM3_L1_PPOIS_PHRASE_MATCHER_H
+#define SEM3_L1_PPOIS_PHRASE_MATCHER_H
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <array>
+#include "Dictionary.h"
+
+/**
+ * @struct phrase_match
+ * @brief Вхождение словарной фразы в текст
+ */
+struct phrase_match {
+    size_t position; ///< Индекс первого байта вхождения в тексте
+    size_t length; ///< Длина вхождения в байтах исходного текста
+    std::string english_phrase; ///< Найденная фраза в том виде, в котором она хранится в словаре
+};
+
+/**
+ * @class phrase_matcher
+ * @brief Автомат Ахо-Корасик для поиска всех английских слов и фраз словаря в тексте.
+ * @details Все ключи словаря хранятся в боре, дополненном суффиксными ссылками, поэтому
+ * текст просматривается один раз независимо от количества и длины фраз.
+ * Регистр букв не учитывается, любая последовательность пробельных символов в тексте
+ * совпадает с одним пробелом фразы. Засчитываются только вхождения целых слов.
+ *
+ * Фразы можно добавлять и удалять по одной: меняется только путь фразы в боре, а
+ * суффиксные ссылки пересчитываются за один обход бора при следующем поиске.
+ * Метод synchronize перестраивает автомат, если отпечаток словаря изменился.
+ *
+ * @see dictionary
+ */
+class phrase_matcher {
+private:
+    /**
+     * @struct trie_node
+     * @brief Состояние автомата
+     */
+    struct trie_node {
+        std::vector<std::pair<char, int>> children; ///< Переходы по символу
+        int failure_link = 0; ///< Состояние для самого длинного собственного суффикса
+        int output_link = -1; ///< Ближайшее по суффиксным ссылкам конечное состояние
+        int depth = 0; ///< Длина пути от корня
+        bool is_terminal = false; ///< Заканчивается ли здесь фраза словаря
+    };
+
+    mutable std::vector<trie_node> nodes; ///< Состояния автомата, нулевое - корень
+    std::array<int, 256> root_children; ///< Переходы из корня по байту, -1 если перехода нет
+    mutable bool links_are_stale; ///< Нужно ли пересчитать суффиксные ссылки
+    size_t phrase_number; ///< Количество фраз в автомате
+    size_t longest_phrase; ///< Верхняя граница длины фраз в байтах
+    uint64_t source_fingerprint; ///< Отпечаток словаря, по которому построен автомат
+
+    /**
+     * @brief Поиск перехода из состояния по символу.
+     * @param node Номер состояния.
+     * @param symbol Символ перехода.
+     * @return Номер следующего состояния или -1, если перехода нет.
+     */
+    int find_child(int node, char symbol) const;
+
+    /**
+     * @brief Пересчитывает суффиксные ссылки обходом бора в ширину.
+     */
+    void build_links() const;
+
+public:
+    /**
+     * @brief Конструктор пустого автомата.
+     */
+    phrase_matcher();
+
+    /**
+     * @brief Конструктор автомата по всем английским словам словаря.
+     * @param dictionary_ Словарь.
+     */
+    explicit phrase_matcher(const dictionary& dictionary_);
+
+    /**
+     * @brief Добавление фразы.
+     * @param english_phrase Фраза в нормализованном виде.
+     * @return true если фраза добавлена, false если она уже была в автомате.
+     * @throw std::invalid_argument если фраза пуста.
+     * @see string_validator::normalize_phrase
+     */
+    bool add_phrase(const std::string& english_phrase);
+
+    /**
+     * @brief Удаление фразы.
+     * @param english_phrase Фраза в нормализованном виде.
+     * @return true если фраза удалена, false если ее не было в автомате.
+     */
+    bool remove_phrase(const std::string& english_phrase);
+
+    /**
+     * @brief Перестроение автомата по всем английским словам словаря.
+     * @param dictionary_ Словарь.
+     */
+    void rebuild(const dictionary& dictionary_);
+
+    /**
+     * @brief Перестраивает автомат, если словарь изменился после последнего перестроения.
+     * @param dictionary_ Словарь.
+     * @return true если автомат был перестроен.
+     * @see dictionary::get_fingerprint
+     */
+    bool synchronize(const dictionary& dictionary_);
+
+    /**
+     * @brief Поиск всех вхождений фраз в текст, включая вложенные и перекрывающиеся.
+     * @param text Текст для поиска.
+     * @return Вхождения в порядке возрастания позиции конца, при равном конце - от длинных к коротким.
+     */
+    std::vector<phrase_match> find_all(const std::string& text) const;
+
+    /**
+     * @brief Поиск неперекрывающихся вхождений, от самых левых и самых длинных.
+     * @param text Текст для поиска.
+     * @return Вхождения в порядке возрастания позиции.
+     * @details Подходит для перевода текста: "look after" выбирается вместо "look".
+     */
+    std::vector<phrase_match> find_longest(const std::string& text) const;
+
+    /**
+     * @brief Получение количества фраз.
+     * @return Количество фраз в автомате.
+     */
+    size_t get_phrase_number() const;
+
+    /**
+     * @brief Получение количества состояний.
+     * @return Количество состояний автомата, включая корень.
+     */
+    size_t get_state_number() const;
+};
+
+#endif //SEM3_L1_PPOIS_PHRASE_MATCHER_H
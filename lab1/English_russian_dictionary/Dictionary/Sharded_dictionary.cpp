@@ -0,0 +1,155 @@
+#include "Sharded_dictionary.h"
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <queue>
+#include <mutex>
+#include <stdexcept>
+#include "String_validator.h"
+
+sharded_dictionary::sharded_dictionary(size_t shard_number) {
+    if (shard_number == 0) shard_number = 1;
+    for (size_t i = 0; i < shard_number; ++i) shards.push_back(std::make_unique<shard>());
+}
+
+sharded_dictionary::shard& sharded_dictionary::shard_for(const std::string& english_word) const {
+    return *shards[std::hash<std::string>{}(english_word) % shards.size()];
+}
+
+bool sharded_dictionary::contains_word(const std::string& english_word) const {
+    const shard& current = shard_for(english_word);
+    std::shared_lock<std::shared_mutex> lock(current.shard_mutex);
+    return current.shard_tree.contains_node(english_word);
+}
+
+std::string sharded_dictionary::operator[](const std::string& english_word) const {
+    const shard& current = shard_for(english_word);
+    std::shared_lock<std::shared_mutex> lock(current.shard_mutex);
+    return current.shard_tree.get_value(english_word);
+}
+
+void sharded_dictionary::set_translation(const std::string& english_word, const std::string& russian_word) {
+    shard& current = shard_for(english_word);
+    std::unique_lock<std::shared_mutex> lock(current.shard_mutex);
+    if (!current.shard_tree.set_value(english_word, russian_word)) throw std::out_of_range("Ключ не найден.");
+}
+
+sharded_dictionary& sharded_dictionary::operator+=(const std::pair<std::string, std::string>& english_russian_pair) {
+    shard& current = shard_for(english_russian_pair.first);
+    std::unique_lock<std::shared_mutex> lock(current.shard_mutex);
+    if (!current.shard_tree.insert_helper(english_russian_pair.first, english_russian_pair.second)) {
+        throw std::invalid_argument("Слово уже существует в словаре");
+    }
+    return *this;
+}
+
+sharded_dictionary& sharded_dictionary::operator-=(const std::string& english_word) {
+    shard& current = shard_for(english_word);
+    std::unique_lock<std::shared_mutex> lock(current.shard_mutex);
+    if (!current.shard_tree.delete_helper(english_word)) {
+        throw std::invalid_argument("Слова не существует в словаре");
+    }
+    return *this;
+}
+
+void sharded_dictionary::for_each_word(
+        const std::function<void(const std::string&, const std::string&)>& function_) const {
+    using shard_iterator = binary_tree<std::string, std::string>::inorder_iterator;
+    std::vector<std::shared_lock<std::shared_mutex>> locks;
+    std::vector<shard_iterator> iterators;
+    for (const auto& current : shards) {
+        locks.emplace_back(current->shard_mutex);
+        iterators.push_back(current->shard_tree.begin_inorder());
+    }
+    auto greater_key = [&iterators](size_t first, size_t second) {
+        return iterators[second].key() < iterators[first].key();
+    };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(greater_key)> smallest(greater_key);
+    for (size_t i = 0; i < iterators.size(); ++i) {
+        if (!iterators[i].is_end()) smallest.push(i);
+    }
+    while (!smallest.empty()) {
+        size_t index = smallest.top();
+        smallest.pop();
+        function_(iterators[index].key(), iterators[index].value());
+        ++iterators[index];
+        if (!iterators[index].is_end()) smallest.push(index);
+    }
+}
+
+std::ostream& operator<<(std::ostream& output, const sharded_dictionary& dictionary_) {
+    size_t counter = 0;
+    dictionary_.for_each_word([&output, &counter](const std::string& english_word, const std::string& russian_word) {
+        output << ++counter << ". " << english_word << " - " << russian_word << "\n";
+    });
+    return output;
+}
+
+std::istream& operator>>(std::istream& input, sharded_dictionary& dictionary_) {
+    string_validator::read_word_pairs(input, [&dictionary_](const std::pair<std::string, std::string>& new_pair) {
+        if (!dictionary_.contains_word(new_pair.first)) dictionary_ += new_pair;
+    });
+    return input;
+}
+
+bool sharded_dictionary::operator==(const sharded_dictionary& other) const {
+    if (this == &other) return true;
+    if (get_fingerprint() != other.get_fingerprint()) return false;
+    return to_dictionary() == other.to_dictionary();
+}
+
+bool sharded_dictionary::operator!=(const sharded_dictionary& other) const {
+    return !(*this == other);
+}
+
+uint64_t sharded_dictionary::get_fingerprint() const {
+    uint64_t fingerprint = 0;
+    for (const auto& current : shards) {
+        std::shared_lock<std::shared_mutex> lock(current->shard_mutex);
+        fingerprint += current->shard_tree.get_fingerprint();
+    }
+    return fingerprint;
+}
+
+int sharded_dictionary::get_size() const {
+    int size = 0;
+    for (const auto& current : shards) {
+        std::shared_lock<std::shared_mutex> lock(current->shard_mutex);
+        size += current->shard_tree.get_size();
+    }
+    return size;
+}
+
+bool sharded_dictionary::is_empty() const {
+    return get_size() == 0;
+}
+
+size_t sharded_dictionary::get_shard_number() const {
+    return shards.size();
+}
+
+void sharded_dictionary::read_from_file(const std::string& file_name) {
+    std::ifstream txt_file(file_name);
+    if (txt_file.is_open()) {
+        txt_file >> *this;
+        txt_file.close();
+    }
+}
+
+bool sharded_dictionary::write_to_file(const std::string& file_name) const {
+    std::ofstream txt_file(file_name, std::ios::binary | std::ios::trunc);
+    if (!txt_file.is_open()) return false;
+    for_each_word([&txt_file](const std::string& english_word, const std::string& russian_word) {
+        txt_file << english_word << " - " << russian_word << '\n';
+    });
+    txt_file.close();
+    return !txt_file.fail();
+}
+
+dictionary sharded_dictionary::to_dictionary() const {
+    dictionary result;
+    for_each_word([&result](const std::string& english_word, const std::string& russian_word) {
+        result += std::make_pair(english_word, russian_word);
+    });
+    return result;
+}
@@ -0,0 +1,192 @@
+/**
+ * @file Sharded_dictionary.h
+ * @author Ященко Александра
+ * @brief Заголовочный файл словаря, разделенного на независимые части.
+ */
+
+#ifndef SEM3_L1_PPOIS_SHARDED_DICTIONARY_H
+#define SEM3_L1_PPOIS_SHARDED_DICTIONARY_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_mutex>
+#include <functional>
+#include <cstdint>
+#include "Binary_tree.h"
+#include "Dictionary.h"
+
+/**
+ * @class sharded_dictionary
+ * @brief Потокобезопасный словарь из нескольких деревьев со своими блокировками.
+ * @details Английские слова распределяются по частям по хешу, поэтому изменения
+ * разных слов, как правило, попадают в разные части и не ждут друг друга.
+ * Операции с одним словом блокируют только его часть: чтение - разделяемо,
+ * изменение - монопольно.
+ *
+ * Обход в порядке возрастания слов (operator<<, for_each_word, write_to_file)
+ * удерживает разделяемые блокировки всех частей и сливает их итераторы через
+ * кучу, время O(n log k) для k частей.
+ *
+ * Перевод возвращается копией, так как ссылка на значение в дереве могла бы
+ * стать недействительной после снятия блокировки.
+ *
+ * @see dictionary
+ * @see binary_tree
+ */
+class sharded_dictionary {
+private:
+    /**
+     * @struct shard
+     * @brief Одна часть словаря
+     */
+    struct shard {
+        mutable std::shared_mutex shard_mutex; ///< Блокировка части
+        binary_tree<std::string, std::string> shard_tree; ///< Слова этой части
+    };
+
+    std::vector<std::unique_ptr<shard>> shards; ///< Части словаря
+
+    /**
+     * @brief Находит часть, в которой хранится слово.
+     * @param english_word Английское слово.
+     * @return Ссылка на часть.
+     */
+    shard& shard_for(const std::string& english_word) const;
+
+public:
+    /**
+     * @brief Конструктор.
+     * @param shard_number Количество частей (не меньше 1).
+     */
+    explicit sharded_dictionary(size_t shard_number = 16);
+
+    sharded_dictionary(const sharded_dictionary&) = delete;
+    sharded_dictionary& operator=(const sharded_dictionary&) = delete;
+
+    /**
+     * @brief Проверяет наличие слова в словаре.
+     * @param english_word Английское слово для поиска.
+     * @return true если слово найдено, false в противном случае.
+     */
+    bool contains_word(const std::string& english_word) const;
+
+    /**
+     * @brief Получение перевода слова.
+     * @param english_word Английское слово.
+     * @return Копия перевода.
+     * @throw std::out_of_range если слова нет в словаре.
+     */
+    std::string operator[](const std::string& english_word) const;
+
+    /**
+     * @brief Изменение перевода существующего слова.
+     * @param english_word Английское слово.
+     * @param russian_word Новый перевод.
+     * @throw std::out_of_range если слова нет в словаре.
+     */
+    void set_translation(const std::string& english_word, const std::string& russian_word);
+
+    /**
+     * @brief Добавление пары слово-перевод.
+     * @param english_russian_pair Пара "английское слово - русский перевод".
+     * @return Ссылка на текущий объект.
+     * @throw std::invalid_argument если слово уже существует в словаре.
+     */
+    sharded_dictionary& operator+=(const std::pair<std::string, std::string>& english_russian_pair);
+
+    /**
+     * @brief Удаление слова.
+     * @param english_word Английское слово для удаления.
+     * @return Ссылка на текущий объект.
+     * @throw std::invalid_argument если слова нет в словаре.
+     */
+    sharded_dictionary& operator-=(const std::string& english_word);
+
+    /**
+     * @brief Обход словаря в порядке возрастания английских слов.
+     * @param function_ Функция, вызываемая для каждой пары слово-перевод.
+     * @details Во время обхода изменения словаря ждут его окончания, поэтому
+     * функция не должна изменять этот словарь.
+     */
+    void for_each_word(const std::function<void(const std::string&, const std::string&)>& function_) const;
+
+    /**
+     * @brief Оператор вывода словаря в поток в порядке возрастания слов.
+     * @param output Выходной поток.
+     * @param dictionary_ Словарь для вывода.
+     * @return Ссылка на выходной поток.
+     * @see operator<<(std::ostream&, const dictionary&)
+     */
+    friend std::ostream& operator<<(std::ostream& output, const sharded_dictionary& dictionary_);
+
+    /**
+     * @brief Оператор ввода словаря из потока.
+     * @param input Входной поток.
+     * @param dictionary_ Словарь для заполнения.
+     * @return Ссылка на входной поток.
+     * @see operator>>(std::istream&, dictionary&)
+     */
+    friend std::istream& operator>>(std::istream& input, sharded_dictionary& dictionary_);
+
+    /**
+     * @brief Оператор сравнения словарей на равенство.
+     * @param other Словарь для сравнения.
+     * @return true если словари содержат одинаковые пары слово-перевод.
+     */
+    bool operator==(const sharded_dictionary& other) const;
+
+    /**
+     * @brief Оператор сравнения словарей на неравенство.
+     * @param other Словарь для сравнения.
+     * @return true если словари различаются.
+     */
+    bool operator!=(const sharded_dictionary& other) const;
+
+    /**
+     * @brief Получение отпечатка содержимого.
+     * @return Отпечаток, совпадающий с dictionary::get_fingerprint для того же содержимого.
+     */
+    uint64_t get_fingerprint() const;
+
+    /**
+     * @brief Получение количества слов в словаре.
+     * @return Количество пар слово-перевод.
+     */
+    int get_size() const;
+
+    /**
+     * @brief Проверка пустоты словаря.
+     * @return true если словарь пуст.
+     */
+    bool is_empty() const;
+
+    /**
+     * @brief Получение количества частей.
+     * @return Количество частей словаря.
+     */
+    size_t get_shard_number() const;
+
+    /**
+     * @brief Чтение словаря из файла.
+     * @param file_name Имя файла для чтения.
+     * @see dictionary::read_from_file
+     */
+    void read_from_file(const std::string& file_name);
+
+    /**
+     * @brief Запись словаря в файл в порядке возрастания слов.
+     * @param file_name Имя файла для записи.
+     * @return true если файл записан, false если его не удалось открыть.
+     * @see dictionary::write_to_file
+     */
+    bool write_to_file(const std::string& file_name) const;
+
+    /**
+     * @brief Копирование содержимого в обычный словарь.
+     * @return Словарь с теми же парами.
+     */
+    dictionary to_dictionary() const;
+};
+
+#endif //SEM3_L1_PPOIS_SHARDED_DICTIONARY_H
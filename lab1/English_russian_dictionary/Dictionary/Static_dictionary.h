@@ -0,0 +1,216 @@
+/**
+ * @file Static_dictionary.h
+ * @author Ященко Александра
+ * @brief Заголовочный файл словаря, построенного на этапе компиляции.
+ */
+
+#ifndef SEM3_L1_PPOIS_STATIC_DICTIONARY_H
+#define SEM3_L1_PPOIS_STATIC_DICTIONARY_H
+
+#include <array>
+#include <string_view>
+#include <stdexcept>
+#include <cstddef>
+
+/**
+ * @struct static_entry
+ * @brief Пара "английское слово - русский перевод" из строковых литералов
+ */
+struct static_entry {
+    std::string_view english_word; ///< Английское слово
+    std::string_view russian_word; ///< Русский перевод
+};
+
+/**
+ * @class static_vocabulary
+ * @brief Неизменяемое представление отсортированного массива пар.
+ * @details Не владеет данными и не выделяет память; поиск - двоичный, O(log n).
+ * Позволяет работать со словарями static_dictionary разного размера через один тип.
+ * @see static_dictionary
+ */
+class static_vocabulary {
+private:
+    const static_entry* entries; ///< Пары в порядке возрастания английских слов
+    size_t entry_number; ///< Количество пар
+
+public:
+    /**
+     * @brief Конструктор.
+     * @param entries_ Указатель на отсортированные пары.
+     * @param entry_number_ Количество пар.
+     */
+    constexpr static_vocabulary(const static_entry* entries_, size_t entry_number_)
+            : entries(entries_), entry_number(entry_number_) {}
+
+    /**
+     * @brief Поиск пары по английскому слову.
+     * @param english_word Английское слово.
+     * @return Указатель на пару или nullptr, если слова нет.
+     */
+    constexpr const static_entry* find(std::string_view english_word) const {
+        size_t left = 0, right = entry_number;
+        while (left < right) {
+            size_t middle = left + (right - left) / 2;
+            if (entries[middle].english_word < english_word) left = middle + 1;
+            else right = middle;
+        }
+        if (left < entry_number && entries[left].english_word == english_word) return entries + left;
+        return nullptr;
+    }
+
+    /**
+     * @brief Проверяет наличие слова.
+     * @param english_word Английское слово.
+     * @return true если слово найдено.
+     */
+    constexpr bool contains_word(std::string_view english_word) const {
+        return find(english_word) != nullptr;
+    }
+
+    /**
+     * @brief Получение перевода слова.
+     * @param english_word Английское слово.
+     * @return Перевод, ссылающийся на строковый литерал.
+     * @throw std::out_of_range если слова нет.
+     */
+    constexpr std::string_view operator[](std::string_view english_word) const {
+        const static_entry* entry = find(english_word);
+        if (!entry) throw std::out_of_range("Ключ не найден.");
+        return entry->russian_word;
+    }
+
+    /**
+     * @brief Получение количества слов.
+     * @return Количество пар.
+     */
+    constexpr size_t get_size() const {
+        return entry_number;
+    }
+
+    /**
+     * @brief Проверка пустоты.
+     * @return true если пар нет.
+     */
+    constexpr bool is_empty() const {
+        return entry_number == 0;
+    }
+
+    /**
+     * @brief Обход пар в порядке возрастания английских слов.
+     * @tparam function Тип функции вида void(std::string_view, std::string_view).
+     * @param function_ Функция, вызываемая для каждой пары.
+     */
+    template<typename function>
+    void for_each_word(function function_) const {
+        for (size_t i = 0; i < entry_number; ++i) function_(entries[i].english_word, entries[i].russian_word);
+    }
+};
+
+/**
+ * @class static_dictionary
+ * @brief Словарь фиксированного размера, отсортированный на этапе компиляции.
+ * @tparam entry_number Количество пар.
+ * @details Объявленный как constexpr, словарь целиком размещается в исполняемом файле:
+ * при запуске программы ничего не читается и память в куче не выделяется.
+ * Повторяющееся английское слово приводит к ошибке компиляции.
+ * Методы поиска повторяют dictionary, но перевод возвращается как std::string_view.
+ * @see make_static_dictionary
+ * @see layered_dictionary
+ */
+template<size_t entry_number>
+class static_dictionary {
+private:
+    std::array<static_entry, entry_number> entries; ///< Пары в порядке возрастания английских слов
+
+public:
+    /**
+     * @brief Конструктор. Сортирует пары вставками и проверяет уникальность слов.
+     * @param unsorted_entries Пары в произвольном порядке.
+     * @throw std::invalid_argument если английское слово повторяется.
+     */
+    constexpr explicit static_dictionary(const std::array<static_entry, entry_number>& unsorted_entries)
+            : entries(unsorted_entries) {
+        for (size_t i = 1; i < entry_number; ++i) {
+            static_entry current = entries[i];
+            size_t position = i;
+            while (position > 0 && current.english_word < entries[position - 1].english_word) {
+                entries[position] = entries[position - 1];
+                --position;
+            }
+            entries[position] = current;
+        }
+        for (size_t i = 1; i < entry_number; ++i) {
+            if (entries[i].english_word == entries[i - 1].english_word) {
+                throw std::invalid_argument("Слово уже существует в словаре");
+            }
+        }
+    }
+
+    /**
+     * @brief Получение представления словаря, не зависящего от размера.
+     * @return Представление static_vocabulary.
+     */
+    constexpr static_vocabulary get_vocabulary() const {
+        return static_vocabulary(entries.data(), entry_number);
+    }
+
+    /**
+     * @brief Проверяет наличие слова.
+     * @param english_word Английское слово.
+     * @return true если слово найдено.
+     */
+    constexpr bool contains_word(std::string_view english_word) const {
+        return get_vocabulary().contains_word(english_word);
+    }
+
+    /**
+     * @brief Получение перевода слова.
+     * @param english_word Английское слово.
+     * @return Перевод.
+     * @throw std::out_of_range если слова нет.
+     */
+    constexpr std::string_view operator[](std::string_view english_word) const {
+        return get_vocabulary()[english_word];
+    }
+
+    /**
+     * @brief Получение количества слов.
+     * @return Количество пар.
+     */
+    constexpr size_t get_size() const {
+        return entry_number;
+    }
+
+    /**
+     * @brief Проверка пустоты.
+     * @return true если пар нет.
+     */
+    constexpr bool is_empty() const {
+        return entry_number == 0;
+    }
+
+    /**
+     * @brief Обход пар в порядке возрастания английских слов.
+     * @tparam function Тип функции вида void(std::string_view, std::string_view).
+     * @param function_ Функция, вызываемая для каждой пары.
+     */
+    template<typename function>
+    void for_each_word(function function_) const {
+        get_vocabulary().for_each_word(function_);
+    }
+};
+
+/**
+ * @brief Создает static_dictionary из списка пар, размер выводится автоматически.
+ * @tparam entry_number Количество пар.
+ * @param unsorted_entries Пары в произвольном порядке.
+ * @return Отсортированный словарь.
+ */
+template<size_t entry_number>
+constexpr static_dictionary<entry_number> make_static_dictionary(const static_entry (&unsorted_entries)[entry_number]) {
+    std::array<static_entry, entry_number> entries{};
+    for (size_t i = 0; i < entry_number; ++i) entries[i] = unsorted_entries[i];
+    return static_dictionary<entry_number>(entries);
+}
+
+#endif //SEM3_L1_PPOIS_STATIC_DICTIONARY_H
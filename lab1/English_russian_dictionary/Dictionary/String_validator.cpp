@@ -33,6 +33,43 @@ bool string_validator::is_correct_length_rus(const std::string& input_word) {
     return (input_word.size()/2 >= 1 && input_word.size()/2 <= 50);
 }
 
+namespace {
+    template<typename validator>
+    bool valid_phrase(const std::string& phrase, validator valid_word) {
+        if (phrase.empty()) return false;
+        size_t word_start = 0;
+        while (true) {
+            size_t word_end = phrase.find(' ', word_start);
+            if (!valid_word(phrase.substr(word_start, word_end - word_start))) return false;
+            if (word_end == std::string::npos) return true;
+            word_start = word_end + 1;
+        }
+    }
+}
+
+bool string_validator::valid_english_phrase(const std::string& english_phrase) {
+    return english_phrase.size() <= 100 && valid_phrase(english_phrase, valid_english_word);
+}
+
+bool string_validator::valid_russian_phrase(const std::string& russian_phrase) {
+    return russian_phrase.size() / 2 <= 100 && valid_phrase(russian_phrase, valid_russian_word);
+}
+
+std::string string_validator::normalize_phrase(const std::string& input_phrase) {
+    std::string result;
+    bool space_pending = false;
+    for (char symbol : input_phrase) {
+        if (std::isspace(static_cast<unsigned char>(symbol))) {
+            space_pending = !result.empty();
+        } else {
+            if (space_pending) result += ' ';
+            space_pending = false;
+            result += symbol;
+        }
+    }
+    return to_lower(result);
+}
+
 std::string string_validator::to_lower(const std::string& input_string) {
     std::string result = input_string;
     for (size_t i = 0; i < result.length(); i++) {
@@ -88,6 +125,18 @@ std::string string_validator::extract_word(const std::string& input_line, std::s
 
 std::pair<std::string, std::string> string_validator::word_pair_input(const std::string& input_line) {
     if (!input_line.empty() && input_line.find_first_not_of("-' \t\n\r")!=std::string::npos) {
+        size_t phrase_separator = input_line.find(" - ");
+        std::string english_phrase = phrase_separator == std::string::npos
+                                     ? std::string() : normalize_phrase(input_line.substr(0, phrase_separator));
+        if (english_phrase.find(' ') != std::string::npos) {
+            std::string english = english_phrase;
+            if (!string_validator::valid_english_phrase(english)) {
+                throw std::invalid_argument("Слово введено неверно");
+            }
+            std::string russian = normalize_phrase(input_line.substr(phrase_separator + 3));
+            if (!string_validator::valid_russian_phrase(russian)) russian = "";
+            return {english, russian};
+        }
         std::string english;
         std::string substrated_line = extract_word(input_line, english);
         if (!string_validator::valid_english_word(english)){
@@ -105,4 +154,24 @@ std::pair<std::string, std::string> string_validator::word_pair_input(const std:
     }
 }
 
-
+size_t string_validator::read_word_pairs(
+        std::istream& input, const std::function<void(const std::pair<std::string, std::string>&)>& add_pair,
+        const std::function<bool(size_t)>& after_line) {
+    size_t skipped_lines = 0;
+    std::string current_line;
+    while (std::getline(input, current_line)) {
+        if (!current_line.empty()) {
+            std::pair<std::string, std::string> new_pair;
+            bool is_parsed = true;
+            try {
+                new_pair = word_pair_input(current_line);
+            } catch (const std::invalid_argument&) {
+                is_parsed = false;
+                skipped_lines++;
+            }
+            if (is_parsed) add_pair(new_pair);
+        }
+        if (after_line && !after_line(current_line.size() + 1)) break;
+    }
+    return skipped_lines;
+}
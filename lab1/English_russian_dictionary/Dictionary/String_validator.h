@@ -15,6 +15,9 @@
 #include <string>
 #include <string>
 #include <cctype>
+#include <istream>
+#include <utility>
+#include <functional>
 
 /**
  * @class string_validator
@@ -56,6 +59,31 @@ public:
      */
     static bool is_correct_length_rus(const std::string&);
 
+    /**
+     * @brief Проверяет корректность английской фразы
+     * @param english_phrase Строка для проверки
+     * @return true если фраза состоит из корректных английских слов, разделенных одним пробелом,
+     * и содержит не более 100 символов
+     * @see normalize_phrase
+     */
+    static bool valid_english_phrase(const std::string&);
+
+    /**
+     * @brief Проверяет корректность русской фразы
+     * @param russian_phrase Строка для проверки
+     * @return true если фраза состоит из корректных русских слов, разделенных одним пробелом,
+     * и содержит не более 100 символов (с учетом UTF-8)
+     * @see valid_english_phrase
+     */
+    static bool valid_russian_phrase(const std::string&);
+
+    /**
+     * @brief Приводит фразу к виду, в котором она хранится в словаре
+     * @param input_phrase Исходная строка
+     * @return Строка в нижнем регистре без пробелов по краям, слова разделены одним пробелом
+     */
+    static std::string normalize_phrase(const std::string&);
+
     /**
      * @brief Преобразует строку к нижнему регистру
      * @param input_string Исходная строка
@@ -84,9 +112,27 @@ public:
      * @brief Извлекает пару слов (английское и русское) из строки
      * @param input_line Исходная строка, содержащая слова
      * @return Пара строк: английское слово и русское слово
-     * @details Русское слово может быть пустым, если оно отсутствует или невалидно
+     * @details Русское слово может быть пустым, если оно отсутствует или невалидно.
+     * Если строка содержит разделитель " - " и слева от него несколько слов, слева читается
+     * английская фраза, справа - русская, например "look after - присматривать за".
+     * Одно слово слева от разделителя разбирается как обычно: из "apple - яблоко (плод)"
+     * получается перевод "яблоко".
      */
     static std::pair<std::string, std::string> word_pair_input(const std::string&);
+
+    /**
+     * @brief Читает из потока пары слов, по одной на строке
+     * @param input Входной поток
+     * @param add_pair Функция вида void(const std::pair<std::string, std::string>&),
+     * вызываемая для каждой разобранной пары
+     * @param after_line Необязательная функция вида bool(size_t line_bytes), вызываемая после
+     * каждой строки с ее длиной вместе с переводом строки; false прекращает чтение
+     * @return Количество непустых строк, пропущенных из-за неверного формата
+     * @details Пустые строки пропускаются. Строка разбирается через word_pair_input.
+     */
+    static size_t read_word_pairs(std::istream& input,
+                                  const std::function<void(const std::pair<std::string, std::string>&)>& add_pair,
+                                  const std::function<bool(size_t)>& after_line = nullptr);
 };
 
 #endif //SEM3_L1_PPOIS_STRING_VALIDATOR_H
@@ -0,0 +1,107 @@
+#include "Translation_list.h"
+#include <stdexcept>
+
+namespace {
+    const char translation_separator = '\0';
+
+    void check_translation(const std::string& translation) {
+        if (translation.find(translation_separator) != std::string::npos) {
+            throw std::invalid_argument("Перевод содержит недопустимый символ");
+        }
+    }
+}
+
+translation_list::translation_list() : translation_number(0) {}
+
+translation_list::translation_list(const std::string& first_translation)
+        : packed_translations(first_translation), translation_number(1) {
+    check_translation(first_translation);
+}
+
+bool translation_list::append(const std::string& translation) {
+    check_translation(translation);
+    if (contains(translation)) return false;
+    if (translation_number > 0) packed_translations += translation_separator;
+    packed_translations += translation;
+    translation_number++;
+    return true;
+}
+
+bool translation_list::remove(std::string_view translation) {
+    size_t start = 0;
+    for (uint32_t i = 0; i < translation_number; ++i) {
+        size_t end = packed_translations.find(translation_separator, start);
+        if (end == std::string::npos) end = packed_translations.size();
+        if (std::string_view(packed_translations).substr(start, end - start) == translation) {
+            if (translation_number == 1) {
+                packed_translations.clear();
+            } else if (end == packed_translations.size()) {
+                packed_translations.erase(start - 1);
+            } else {
+                packed_translations.erase(start, end - start + 1);
+            }
+            translation_number--;
+            return true;
+        }
+        start = end + 1;
+    }
+    return false;
+}
+
+bool translation_list::contains(std::string_view translation) const {
+    std::string_view packed(packed_translations);
+    size_t start = 0;
+    for (uint32_t i = 0; i < translation_number; ++i) {
+        size_t end = packed.find(translation_separator, start);
+        if (end == std::string_view::npos) end = packed.size();
+        if (packed.substr(start, end - start) == translation) return true;
+        start = end + 1;
+    }
+    return false;
+}
+
+std::string_view translation_list::operator[](size_t index) const {
+    if (index >= translation_number) throw std::out_of_range("Перевода с таким номером нет");
+    size_t start = 0;
+    for (size_t i = 0; i < index; ++i) start = packed_translations.find(translation_separator, start) + 1;
+    size_t end = packed_translations.find(translation_separator, start);
+    if (end == std::string::npos) end = packed_translations.size();
+    return std::string_view(packed_translations).substr(start, end - start);
+}
+
+std::string_view translation_list::primary() const {
+    if (translation_number == 0) return {};
+    return (*this)[0];
+}
+
+std::vector<std::string> translation_list::to_vector() const {
+    std::vector<std::string> result;
+    result.reserve(translation_number);
+    for_each([&result](std::string_view translation) { result.emplace_back(translation); });
+    return result;
+}
+
+size_t translation_list::size() const {
+    return translation_number;
+}
+
+bool translation_list::empty() const {
+    return translation_number == 0;
+}
+
+size_t translation_list::heap_bytes() const {
+    if (packed_translations.capacity() <= std::string().capacity()) return 0;
+    return packed_translations.capacity() + 1;
+}
+
+const std::string& translation_list::get_packed() const {
+    return packed_translations;
+}
+
+bool translation_list::operator==(const translation_list& other) const {
+    return translation_number == other.translation_number && packed_translations == other.packed_translations;
+}
+
+bool translation_list::operator!=(const translation_list& other) const {
+    return !(*this == other);
+}
@@ -0,0 +1,155 @@
+/**
+ * @file Translation_list.h
+ * @author Ященко Александра
+ * @brief Заголовочный файл компактного списка переводов одного слова.
+ */
+
+#ifndef SEM3_L1_PPOIS_TRANSLATION_LIST_H
+#define SEM3_L1_PPOIS_TRANSLATION_LIST_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+/**
+ * @class translation_list
+ * @brief Список переводов, хранящийся в одной строке.
+ * @details Переводы записаны подряд в одну строку через символ '\0'. Объект занимает
+ * 40 байт; один короткий перевод помещается во внутренний буфер строки без выделения
+ * памяти, а любое количество переводов занимает не больше одного блока в куче.
+ * Для сравнения, std::vector<std::string> всегда выделяет блок под массив строк
+ * и еще по блоку на каждую длинную строку.
+ *
+ * Первый перевод считается основным. Добавление перевода дописывает его в конец
+ * строки и не требует пересоздания узла дерева, в котором хранится список.
+ *
+ * @see multi_dictionary
+ */
+class translation_list {
+private:
+    std::string packed_translations; ///< Переводы, разделенные символом '\0'
+    uint32_t translation_number; ///< Количество переводов
+
+public:
+    /**
+     * @brief Конструктор пустого списка.
+     */
+    translation_list();
+
+    /**
+     * @brief Конструктор списка из одного перевода.
+     * @param first_translation Основной перевод.
+     * @throw std::invalid_argument если перевод содержит символ '\0'.
+     */
+    explicit translation_list(const std::string& first_translation);
+
+    /**
+     * @brief Добавление перевода в конец списка.
+     * @param translation Перевод.
+     * @return true если перевод добавлен, false если он уже был в списке.
+     * @throw std::invalid_argument если перевод содержит символ '\0'.
+     */
+    bool append(const std::string& translation);
+
+    /**
+     * @brief Удаление перевода.
+     * @param translation Перевод.
+     * @return true если перевод удален, false если его не было в списке.
+     */
+    bool remove(std::string_view translation);
+
+    /**
+     * @brief Проверка наличия перевода.
+     * @param translation Перевод.
+     * @return true если перевод есть в списке.
+     */
+    bool contains(std::string_view translation) const;
+
+    /**
+     * @brief Получение перевода по номеру.
+     * @param index Номер перевода, 0 - основной.
+     * @return Перевод.
+     * @throw std::out_of_range если номер не меньше size().
+     */
+    std::string_view operator[](size_t index) const;
+
+    /**
+     * @brief Получение основного перевода.
+     * @return Первый перевод или пустая строка, если список пуст.
+     */
+    std::string_view primary() const;
+
+    /**
+     * @brief Обход переводов в порядке добавления.
+     * @tparam function Тип функции вида void(std::string_view).
+     * @param function_ Функция, вызываемая для каждого перевода.
+     */
+    template<typename function>
+    void for_each(function function_) const {
+        size_t start = 0;
+        for (uint32_t i = 0; i < translation_number; ++i) {
+            size_t end = packed_translations.find('\0', start);
+            if (end == std::string::npos) end = packed_translations.size();
+            function_(std::string_view(packed_translations).substr(start, end - start));
+            start = end + 1;
+        }
+    }
+
+    /**
+     * @brief Копирование переводов в вектор строк.
+     * @return Переводы в порядке добавления.
+     */
+    std::vector<std::string> to_vector() const;
+
+    /**
+     * @brief Получение количества переводов.
+     * @return Количество переводов.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Проверка пустоты списка.
+     * @return true если переводов нет.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Получение объема памяти, выделенной в куче.
+     * @return Размер блока строки в байтах, 0 если переводы помещаются во внутренний буфер.
+     */
+    size_t heap_bytes() const;
+
+    /**
+     * @brief Получение строки со всеми переводами.
+     * @return Переводы, разделенные символом '\0'.
+     */
+    const std::string& get_packed() const;
+
+    /**
+     * @brief Оператор сравнения на равенство.
+     * @param other Список для сравнения.
+     * @return true если переводы и их порядок совпадают.
+     */
+    bool operator==(const translation_list& other) const;
+
+    /**
+     * @brief Оператор сравнения на неравенство.
+     * @param other Список для сравнения.
+     * @return true если списки различаются.
+     */
+    bool operator!=(const translation_list& other) const;
+};
+
+/**
+ * @brief Хеш списка переводов, нужен для отпечатка binary_tree.
+ */
+template<>
+struct std::hash<translation_list> {
+    size_t operator()(const translation_list& translations) const {
+        return std::hash<std::string>{}(translations.get_packed());
+    }
+};
+
+#endif //SEM3_L1_PPOIS_TRANSLATION_LIST_H
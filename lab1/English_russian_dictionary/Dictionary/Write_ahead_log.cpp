@@ -0,0 +1,224 @@
+#include "Write_ahead_log.h"
+#include <fstream>
+#include <stdexcept>
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <fcntl.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+    void append_escaped(std::string& record, const std::string& field) {
+        for (char symbol : field) {
+            switch (symbol) {
+                case '\t': record += "\\t"; break;
+                case '\n': record += "\\n"; break;
+                case '\r': record += "\\r"; break;
+                case '\\': record += "\\\\"; break;
+                default: record += symbol;
+            }
+        }
+    }
+
+    bool unescape_field(const std::string& field, std::string& result) {
+        result.clear();
+        result.reserve(field.size());
+        for (size_t i = 0; i < field.size(); ++i) {
+            if (field[i] != '\\') {
+                result += field[i];
+                continue;
+            }
+            if (++i == field.size()) return false;
+            switch (field[i]) {
+                case 't': result += '\t'; break;
+                case 'n': result += '\n'; break;
+                case 'r': result += '\r'; break;
+                case '\\': result += '\\'; break;
+                default: return false;
+            }
+        }
+        return true;
+    }
+}
+
+uint32_t write_ahead_log::checksum(const std::string& data) {
+    static const std::array<uint32_t, 256> crc_table = [] {
+        std::array<uint32_t, 256> table{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t value = i;
+            for (int bit = 0; bit < 8; ++bit) value = (value & 1) ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+            table[i] = value;
+        }
+        return table;
+    }();
+    uint32_t crc = 0xFFFFFFFFu;
+    for (unsigned char symbol : data) crc = crc_table[(crc ^ symbol) & 0xFF] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+write_ahead_log::write_ahead_log(const std::string& file_name, size_t sync_batch_size_)
+        : log_file_name(file_name), log_file(nullptr), sync_batch_size(sync_batch_size_),
+          unsynced_records(0), record_number(0) {
+    open_for_append();
+}
+
+write_ahead_log::~write_ahead_log() {
+    if (log_file) {
+        try {
+            sync();
+        } catch (const std::runtime_error&) {
+            // Деструктор не может сообщить об ошибке; несброшенные записи ограничены одной группой
+        }
+        std::fclose(log_file);
+    }
+}
+
+void write_ahead_log::open_for_append() {
+    log_file = std::fopen(log_file_name.c_str(), "ab");
+    if (!log_file) {
+        throw std::runtime_error("Не удалось открыть журнал " + log_file_name);
+    }
+}
+
+std::string write_ahead_log::with_checksum(const std::string& record) {
+    char checksum_text[16];
+    std::snprintf(checksum_text, sizeof(checksum_text), "\t%08x\n", checksum(record));
+    return record + checksum_text;
+}
+
+std::string write_ahead_log::put_record(const std::string& english_word, const std::string& russian_word) {
+    std::string record = "P\t";
+    append_escaped(record, english_word);
+    record += '\t';
+    append_escaped(record, russian_word);
+    return with_checksum(record);
+}
+
+std::string write_ahead_log::delete_record(const std::string& english_word) {
+    std::string record = "D\t";
+    append_escaped(record, english_word);
+    return with_checksum(record);
+}
+
+void write_ahead_log::append_line(const std::string& line) {
+    if (std::fwrite(line.data(), 1, line.size(), log_file) != line.size() || std::fflush(log_file) != 0) {
+        throw std::runtime_error("Не удалось записать журнал " + log_file_name);
+    }
+    record_number++;
+    unsynced_records++;
+    if (sync_batch_size && unsynced_records >= sync_batch_size) sync();
+}
+
+void write_ahead_log::append_put(const std::string& english_word, const std::string& russian_word) {
+    append_line(put_record(english_word, russian_word));
+}
+
+void write_ahead_log::append_delete(const std::string& english_word) {
+    append_line(delete_record(english_word));
+}
+
+void write_ahead_log::sync() {
+    bool is_synced = std::fflush(log_file) == 0;
+    if (is_synced && sync_batch_size && unsynced_records) {
+#ifdef _WIN32
+        is_synced = _commit(_fileno(log_file)) == 0;
+#else
+        is_synced = fsync(fileno(log_file)) == 0;
+#endif
+    }
+    if (!is_synced) throw std::runtime_error("Не удалось сбросить на диск журнал " + log_file_name);
+    unsynced_records = 0;
+}
+
+void write_ahead_log::sync_file(const std::string& file_name) {
+#ifdef _WIN32
+    int descriptor = _open(file_name.c_str(), _O_RDWR | _O_BINARY);
+    bool is_synced = descriptor >= 0 && _commit(descriptor) == 0;
+    if (descriptor >= 0) _close(descriptor);
+#else
+    int descriptor = open(file_name.c_str(), O_RDONLY);
+    bool is_synced = descriptor >= 0 && fsync(descriptor) == 0;
+    if (descriptor >= 0) close(descriptor);
+#endif
+    if (!is_synced) throw std::runtime_error("Не удалось сбросить на диск " + file_name);
+}
+
+void write_ahead_log::sync_directory(const std::string& directory_name) {
+#ifndef _WIN32
+    int descriptor = open(directory_name.c_str(), O_RDONLY);
+    bool is_synced = descriptor >= 0 && fsync(descriptor) == 0;
+    if (descriptor >= 0) close(descriptor);
+    if (!is_synced) throw std::runtime_error("Не удалось сбросить на диск " + directory_name);
+#else
+    (void)directory_name;
+#endif
+}
+
+size_t write_ahead_log::read_records(
+        std::istream& input, const std::function<void(bool, const std::string&, const std::string&)>& apply_record,
+        std::uintmax_t& valid_bytes) {
+    size_t replayed = 0;
+    valid_bytes = 0;
+    std::string current_line, english_word, russian_word;
+    while (std::getline(input, current_line)) {
+        if (input.eof()) break;
+        size_t checksum_separator = current_line.rfind('\t');
+        if (checksum_separator == std::string::npos || current_line.size() - checksum_separator != 9) break;
+        std::string record = current_line.substr(0, checksum_separator);
+        char* checksum_end = nullptr;
+        unsigned long stored_checksum = std::strtoul(current_line.c_str() + checksum_separator + 1, &checksum_end, 16);
+        if (*checksum_end != '\0' || stored_checksum != checksum(record)) break;
+        if (record.size() < 3 || record[1] != '\t') break;
+        std::string payload = record.substr(2);
+        if (record[0] == 'P') {
+            size_t separator = payload.find('\t');
+            if (separator == std::string::npos || separator == 0) break;
+            if (!unescape_field(payload.substr(0, separator), english_word) ||
+                !unescape_field(payload.substr(separator + 1), russian_word)) break;
+            apply_record(false, english_word, russian_word);
+        } else if (record[0] == 'D') {
+            if (!unescape_field(payload, english_word)) break;
+            apply_record(true, english_word, "");
+        } else break;
+        replayed++;
+        valid_bytes += current_line.size() + 1;
+    }
+    return replayed;
+}
+
+size_t write_ahead_log::replay(
+        const std::function<void(bool, const std::string&, const std::string&)>& apply_record) {
+    std::ifstream input(log_file_name, std::ios::binary);
+    std::uintmax_t valid_bytes = 0;
+    size_t replayed = read_records(input, apply_record, valid_bytes);
+    input.close();
+    std::error_code error;
+    if (std::filesystem::file_size(log_file_name, error) > valid_bytes && !error) {
+        std::fclose(log_file);
+        std::filesystem::resize_file(log_file_name, valid_bytes, error);
+        open_for_append();
+    }
+    record_number = replayed;
+    return replayed;
+}
+
+void write_ahead_log::truncate() {
+    std::fclose(log_file);
+    log_file = std::fopen(log_file_name.c_str(), "wb");
+    if (log_file) std::fclose(log_file);
+    open_for_append();
+    record_number = 0;
+    unsynced_records = 0;
+}
+
+size_t write_ahead_log::get_record_number() const {
+    return record_number;
+}
+
+const std::string& write_ahead_log::get_file_name() const {
+    return log_file_name;
+}
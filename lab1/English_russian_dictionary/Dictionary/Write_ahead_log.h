@@ -0,0 +1,178 @@
+/**
+ * @file Write_ahead_log.h
+ * @author Ященко Александра
+ * @brief Заголовочный файл журнала упреждающей записи.
+ */
+
+#ifndef SEM3_L1_PPOIS_WRITE_AHEAD_LOG_H
+#define SEM3_L1_PPOIS_WRITE_AHEAD_LOG_H
+
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <functional>
+#include <istream>
+
+/**
+ * @class write_ahead_log
+ * @brief Журнал изменений словаря, дописываемый в конец файла.
+ * @details Каждая запись занимает одну строку: "P<TAB>слово<TAB>перевод<TAB>crc" для вставки
+ * или изменения и "D<TAB>слово<TAB>crc" для удаления, где crc - контрольная сумма CRC-32
+ * остальной части строки в шестнадцатеричном виде. Табуляция, перевод строки, возврат
+ * каретки и обратная косая черта в словах записываются как \\t, \\n, \\r и \\\\, поэтому
+ * любые строки сохраняются без потерь.
+ *
+ * Записи сбрасываются на диск (fsync) группами: после каждых sync_batch_size записей или
+ * при явном вызове sync(). Записи последней несброшенной группы могут быть потеряны при
+ * отказе питания, но не при аварийном завершении процесса.
+ *
+ * При воспроизведении журнал читается до первой оборванной или поврежденной записи,
+ * а сам файл обрезается по последней корректной записи.
+ */
+class write_ahead_log {
+private:
+    std::string log_file_name; ///< Имя файла журнала
+    std::FILE* log_file; ///< Файл, открытый для дозаписи
+    size_t sync_batch_size; ///< Количество записей в группе, 0 - не вызывать fsync
+    size_t unsynced_records; ///< Количество записей с момента последнего fsync
+    size_t record_number; ///< Количество записей в журнале
+
+    /**
+     * @brief Добавляет к записи контрольную сумму и перевод строки.
+     * @param record Строка записи.
+     * @return Готовая строка журнала.
+     */
+    static std::string with_checksum(const std::string& record);
+
+    /**
+     * @brief Дописывает готовую строку в журнал.
+     * @param line Строка записи с контрольной суммой и переводом строки.
+     */
+    void append_line(const std::string& line);
+
+    /**
+     * @brief Открывает файл журнала для дозаписи.
+     * @throw std::runtime_error если файл не удалось открыть.
+     */
+    void open_for_append();
+
+public:
+    /**
+     * @brief Вычисляет контрольную сумму CRC-32.
+     * @param data Данные для подсчета.
+     * @return Контрольная сумма.
+     */
+    static uint32_t checksum(const std::string& data);
+
+    /**
+     * @brief Сбрасывает на диск содержимое файла.
+     * @param file_name Имя файла.
+     * @throw std::runtime_error если файл не удалось открыть или сбросить.
+     * @details Вызывается перед атомарным переименованием временного файла, чтобы после
+     *          отказа питания под новым именем не оказался пустой или неполный файл.
+     */
+    static void sync_file(const std::string& file_name);
+
+    /**
+     * @brief Сбрасывает на диск записи каталога: созданные и переименованные файлы.
+     * @param directory_name Имя каталога.
+     * @throw std::runtime_error если каталог не удалось открыть или сбросить.
+     * @details В Windows метаданные каталога сбрасываются файловой системой, и функция ничего не делает.
+     */
+    static void sync_directory(const std::string& directory_name);
+
+    /**
+     * @brief Формирует строку записи вставки в формате журнала.
+     * @param english_word Английское слово.
+     * @param russian_word Перевод.
+     * @return Строка с контрольной суммой и переводом строки.
+     * @details Используется и для снимков journaled_dictionary, которые хранятся в том же формате.
+     */
+    static std::string put_record(const std::string& english_word, const std::string& russian_word);
+
+    /**
+     * @brief Формирует строку записи удаления в формате журнала.
+     * @param english_word Английское слово.
+     * @return Строка с контрольной суммой и переводом строки.
+     */
+    static std::string delete_record(const std::string& english_word);
+
+    /**
+     * @brief Читает записи в формате журнала из потока.
+     * @param input Поток, открытый в двоичном режиме.
+     * @param apply_record Функция вида void(bool is_deleted, const std::string& english_word,
+     *                     const std::string& russian_word), вызываемая для каждой корректной записи.
+     * @param[out] valid_bytes Длина прочитанных корректных записей в байтах.
+     * @return Количество прочитанных записей.
+     * @details Чтение останавливается на первой оборванной или поврежденной записи.
+     */
+    static size_t read_records(std::istream& input,
+                               const std::function<void(bool, const std::string&, const std::string&)>& apply_record,
+                               std::uintmax_t& valid_bytes);
+
+    /**
+     * @brief Конструктор. Открывает (или создает) файл журнала для дозаписи.
+     * @param file_name Имя файла журнала.
+     * @param sync_batch_size_ Количество записей, после которого вызывается fsync;
+     *                         1 - после каждой записи, 0 - никогда.
+     * @throw std::runtime_error если файл не удалось открыть.
+     */
+    explicit write_ahead_log(const std::string& file_name, size_t sync_batch_size_ = 0);
+
+    /**
+     * @brief Деструктор. Сбрасывает несохраненные записи и закрывает файл.
+     */
+    ~write_ahead_log();
+
+    write_ahead_log(const write_ahead_log&) = delete;
+    write_ahead_log& operator=(const write_ahead_log&) = delete;
+
+    /**
+     * @brief Записывает вставку или изменение перевода.
+     * @param english_word Английское слово.
+     * @param russian_word Перевод.
+     * @throw std::runtime_error если запись или сброс группы на диск не удались.
+     */
+    void append_put(const std::string& english_word, const std::string& russian_word);
+
+    /**
+     * @brief Записывает удаление слова.
+     * @param english_word Английское слово.
+     * @throw std::runtime_error если запись или сброс группы на диск не удались.
+     */
+    void append_delete(const std::string& english_word);
+
+    /**
+     * @brief Сбрасывает все записанные записи на диск.
+     * @throw std::runtime_error если fflush или fsync завершились ошибкой; записи группы
+     *        при этом не считаются сохраненными.
+     */
+    void sync();
+
+    /**
+     * @brief Воспроизводит журнал с начала файла.
+     * @param apply_record Функция вида void(bool is_deleted, const std::string& english_word,
+     *                     const std::string& russian_word), вызываемая для каждой корректной записи.
+     * @return Количество воспроизведенных записей.
+     */
+    size_t replay(const std::function<void(bool, const std::string&, const std::string&)>& apply_record);
+
+    /**
+     * @brief Очищает журнал после того, как его содержимое сохранено в другом месте.
+     */
+    void truncate();
+
+    /**
+     * @brief Получение количества записей в журнале.
+     * @return Количество записей, включая воспроизведенные.
+     */
+    size_t get_record_number() const;
+
+    /**
+     * @brief Получение имени файла журнала.
+     * @return Имя файла.
+     */
+    const std::string& get_file_name() const;
+};
+
+#endif //SEM3_L1_PPOIS_WRITE_AHEAD_LOG_H
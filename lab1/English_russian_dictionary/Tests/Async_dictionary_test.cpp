@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <fstream>
+#include <cstdio>
+#include <atomic>
+#include <stdexcept>
+#include "Async_dictionary.h"
+
+namespace {
+    void write_test_file(const std::string& file_name, int word_number) {
+        std::ofstream txt_file(file_name);
+        for (int i = 0; i < word_number; ++i) {
+            std::string english_word;
+            for (int number = i; ; number /= 26) {
+                english_word += static_cast<char>('a' + number % 26);
+                if (number < 26) break;
+            }
+            txt_file << "w" << english_word << " - слово\n";
+        }
+    }
+}
+
+TEST(AsyncDictionaryTest, LoadPublishesNewVersionAndKeepsOldSnapshot) {
+    const std::string file_name = "async_dictionary_test.txt";
+    write_test_file(file_name, 20000);
+    dictionary initial;
+    initial += std::make_pair("wa", "свое");
+    async_dictionary dict(initial);
+    std::shared_ptr<const dictionary> before = dict.snapshot();
+    std::atomic<size_t> last_loaded(0), last_total(0);
+
+    dict.load_async(file_name, [&](size_t loaded, size_t total) {
+        EXPECT_GE(loaded, last_loaded.load());
+        last_loaded = loaded;
+        last_total = total;
+    });
+    EXPECT_TRUE(dict.contains_word("wa"));
+    std::shared_ptr<const dictionary> after = dict.wait_ready();
+
+    EXPECT_TRUE(dict.is_ready());
+    EXPECT_EQ(dict.get_progress(), 1.0);
+    EXPECT_EQ(last_loaded, last_total);
+    EXPECT_GT(last_total, 0u);
+    EXPECT_EQ(before->get_size(), 1);
+    EXPECT_EQ(after->get_size(), 20000);
+    EXPECT_EQ(dict.get_size(), 20000);
+    EXPECT_EQ(dict["wa"], "свое");
+    EXPECT_EQ(dict["wb"], "слово");
+    std::remove(file_name.c_str());
+}
+
+TEST(AsyncDictionaryTest, MissingFileReportedByWaitReadyOnce) {
+    async_dictionary dict;
+    dict.load_async("async_dictionary_missing.txt");
+    EXPECT_THROW(dict.wait_ready(), std::runtime_error);
+    EXPECT_NO_THROW(dict.wait_ready());
+    EXPECT_TRUE(dict.snapshot()->is_empty());
+    EXPECT_THROW(dict["wa"], std::out_of_range);
+}
+
+TEST(AsyncDictionaryTest, SecondLoadWhileLoadingIsRejected) {
+    const std::string file_name = "async_dictionary_second.txt";
+    write_test_file(file_name, 1000);
+    async_dictionary dict;
+    std::atomic<bool> release(false);
+    dict.load_async(file_name, [&release](size_t, size_t) {
+        while (!release) std::this_thread::yield();
+    });
+    EXPECT_FALSE(dict.is_ready());
+    EXPECT_THROW(dict.load_async(file_name), std::runtime_error);
+    release = true;
+    dict.wait_ready();
+    dict.load_async(file_name);
+    EXPECT_EQ(dict.wait_ready()->get_size(), 1000);
+    std::remove(file_name.c_str());
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <sstream>
+#include <cstdio>
+#include "Batch_executor.h"
+
+TEST(BatchExecutorTest, Commands_ChangeDictionaryAndPrintResults) {
+    dictionary dict;
+    std::ostringstream output;
+    std::istringstream commands("add apple - яблоко\n"
+                                "add look after - присматривать за\n"
+                                "\n"
+                                "# комментарий\n"
+                                "get  Look After \n"
+                                "set apple - яблочко\n"
+                                "get apple\n"
+                                "add cat кошка\n"
+                                "del cat\n");
+    batch_executor executor(dict, output);
+    batch_report report = executor.execute(commands);
+
+    EXPECT_EQ(report.command_number, 7);
+    EXPECT_EQ(report.error_number, 0);
+    EXPECT_EQ(output.str(), "look after - присматривать за\napple - яблочко\n");
+    EXPECT_EQ(dict.get_size(), 2);
+    EXPECT_FALSE(dict.contains_word("cat"));
+}
+
+TEST(BatchExecutorTest, Errors_AreCountedAndDoNotStopExecution) {
+    dictionary dict;
+    std::ostringstream output;
+    std::istringstream commands("add apple - яблоко\n"
+                                "add apple - яблоко\n"
+                                "jump apple\n"
+                                "get book\n"
+                                "add book\n"
+                                "load missing_batch_file.txt\n"
+                                "add book - книга\n");
+    batch_executor executor(dict, output);
+    batch_report report = executor.execute(commands);
+
+    EXPECT_EQ(report.command_number, 7);
+    EXPECT_EQ(report.error_number, 5);
+    ASSERT_EQ(report.errors.size(), 5);
+    EXPECT_EQ(report.errors[1].rfind("строка 3: ", 0), 0);
+    EXPECT_EQ(dict.get_size(), 2);
+
+    std::ostringstream printed_report;
+    printed_report << report;
+    EXPECT_NE(printed_report.str().find("ошибок: 5"), std::string::npos);
+}
+
+TEST(BatchExecutorTest, DumpAndLoad_RoundTripThroughFile) {
+    const std::string file_name = "batch_test_dump.txt";
+    dictionary source;
+    std::ostringstream output;
+    std::istringstream commands("add give up - сдаваться\nadd dog - собака\ndump " + file_name + "\ndump\n");
+    batch_executor(source, output).execute(commands);
+    EXPECT_EQ(output.str(), "dog - собака\ngive up - сдаваться\n");
+
+    dictionary loaded;
+    std::istringstream load_commands("load " + file_name + "\n");
+    batch_report report = batch_executor(loaded, output).execute(load_commands);
+    EXPECT_EQ(report.error_number, 0);
+    EXPECT_EQ(loaded, source);
+    std::remove(file_name.c_str());
+}
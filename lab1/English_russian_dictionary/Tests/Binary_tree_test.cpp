@@ -1,10 +1,73 @@
 #include <gtest/gtest.h>
 #include <string>
 #include <map>
+#include <atomic>
+#include <vector>
+#include <ostream>
 #include "Binary_tree.h"
 
 using namespace std;
 
+namespace {
+    // Строка, считающая свои копии. Новый узел дерева всегда копирует значение,
+    // поэтому число копий равно числу созданных узлов.
+    struct counted_string {
+        static size_t copy_counter;
+        string text;
+
+        counted_string() = default;
+        counted_string(string text_) : text(std::move(text_)) {}
+        counted_string(const char* text_) : text(text_) {}
+        counted_string(const counted_string& other) : text(other.text) { copy_counter++; }
+        counted_string(counted_string&&) noexcept = default;
+        counted_string& operator=(const counted_string& other) {
+            text = other.text;
+            copy_counter++;
+            return *this;
+        }
+        counted_string& operator=(counted_string&&) noexcept = default;
+
+        friend bool operator==(const counted_string& left, const counted_string& right) {
+            return left.text == right.text;
+        }
+        friend bool operator!=(const counted_string& left, const counted_string& right) {
+            return !(left == right);
+        }
+        friend ostream& operator<<(ostream& output, const counted_string& value) {
+            return output << value.text;
+        }
+    };
+
+    size_t counted_string::copy_counter = 0;
+
+    // Значение, копирование которого бросает исключение после заданного числа копий
+    struct fragile_value {
+        static int live_number;
+        static int copies_left;
+        int payload;
+
+        fragile_value(int payload_) : payload(payload_) { live_number++; }
+        fragile_value(const fragile_value& other) : payload(other.payload) {
+            if (copies_left-- == 0) throw runtime_error("копирование не удалось");
+            live_number++;
+        }
+        fragile_value& operator=(const fragile_value&) = default;
+        ~fragile_value() { live_number--; }
+    };
+
+    int fragile_value::live_number = 0;
+    int fragile_value::copies_left = -1;
+}
+
+namespace std {
+    template<>
+    struct hash<counted_string> {
+        size_t operator()(const counted_string& value) const {
+            return hash<string>{}(value.text);
+        }
+    };
+}
+
 class BinaryTreeTest : public ::testing::Test {
 protected:
     void SetUp() override {
@@ -336,3 +399,318 @@ TEST_F(BinaryTreeTest, EmptyTreeOperations) {
     EXPECT_FALSE(empty_tree.delete_helper(1));
     EXPECT_FALSE(empty_tree.contains_node(1));
 }
+
+// Проверка свойств AVL-дерева: порядок ключей, высоты и баланс каждого узла
+template<typename node_pointer>
+int checked_height(node_pointer current) {
+    if (!current) return 0;
+    int left_height = checked_height(current->left_child);
+    int right_height = checked_height(current->right_child);
+    EXPECT_LE(abs(left_height - right_height), 1);
+    EXPECT_EQ(current->node_height, 1 + max(left_height, right_height));
+    if (current->left_child) {
+        EXPECT_LT(current->left_child->key_t, current->key_t);
+    }
+    if (current->right_child) {
+        EXPECT_LT(current->key_t, current->right_child->key_t);
+    }
+    return current->node_height;
+}
+
+TEST_F(BinaryTreeTest, EqualityOperator_DifferentShapesSameContent) {
+    binary_tree<int, string> ascending;
+    binary_tree<int, string> descending;
+    for (int i = 1; i <= 7; ++i) ascending.insert_helper(i, to_string(i));
+    for (int i = 7; i >= 1; --i) descending.insert_helper(i, to_string(i));
+    descending.insert_helper(8, "8");
+    descending.delete_helper(8);
+    ascending.delete_helper(4);
+    ascending.insert_helper(4, "4");
+
+    EXPECT_NE(ascending.get_tree_root()->key_t, descending.get_tree_root()->key_t);
+    EXPECT_TRUE(ascending == descending);
+}
+
+TEST_F(BinaryTreeTest, InorderIterator_VisitsKeysInOrder) {
+    vector<int> keys;
+    for (auto current = tree1.begin_inorder(); !current.is_end(); ++current) {
+        keys.push_back(current.key());
+    }
+
+    EXPECT_EQ(keys, vector<int>({3, 5, 7}));
+    EXPECT_TRUE(empty_tree.begin_inorder().is_end());
+}
+
+TEST_F(BinaryTreeTest, MergeWith_ResolvesConflictsWithResolver) {
+    tree1.merge_with(tree2, [](int, const string& own, const string& other) {
+        return own + "/" + other;
+    });
+
+    EXPECT_EQ(tree1.get_size(), 5);
+    EXPECT_EQ(tree1.get_value(5), "five/five");
+    EXPECT_EQ(tree1.get_value(15), "fifteen");
+    EXPECT_EQ(tree2.get_size(), 3);
+    checked_height(tree1.get_tree_root());
+}
+
+TEST_F(BinaryTreeTest, MergeWith_LargeUnbalancedSizesStaysBalanced) {
+    binary_tree<int, string> large_tree;
+    binary_tree<int, string> small_tree;
+    for (int i = 0; i < 1000; i += 2) large_tree.insert_helper(i, "large");
+    for (int i = 0; i < 1000; i += 37) small_tree.insert_helper(i, "small");
+
+    large_tree.merge_with(small_tree, [](int, const string&, const string& other) { return other; });
+
+    EXPECT_EQ(large_tree.get_value(0), "small");
+    EXPECT_EQ(large_tree.get_value(2), "large");
+    EXPECT_EQ(large_tree.get_value(37), "small");
+    EXPECT_EQ(large_tree.get_size(), 500 + 14);
+    checked_height(large_tree.get_tree_root());
+
+    empty_tree.merge_with(large_tree, [](int, const string& own, const string&) { return own; });
+    EXPECT_TRUE(empty_tree == large_tree);
+}
+
+TEST_F(BinaryTreeTest, Fingerprint_IndependentOfInsertionOrder) {
+    binary_tree<int, string> reordered;
+    reordered.insert_helper(7, "seven");
+    reordered.insert_helper(3, "three");
+    reordered.insert_helper(5, "five");
+
+    EXPECT_EQ(reordered.get_fingerprint(), tree1.get_fingerprint());
+    EXPECT_NE(tree1.get_fingerprint(), tree2.get_fingerprint());
+    EXPECT_EQ(empty_tree.get_fingerprint(), 0);
+}
+
+TEST_F(BinaryTreeTest, Fingerprint_TracksInsertDeleteAndSetValue) {
+    uint64_t original = tree1.get_fingerprint();
+
+    tree1.insert_helper(9, "nine");
+    EXPECT_NE(tree1.get_fingerprint(), original);
+    tree1.delete_helper(9);
+    EXPECT_EQ(tree1.get_fingerprint(), original);
+
+    EXPECT_TRUE(tree1.set_value(5, "пять"));
+    EXPECT_NE(tree1.get_fingerprint(), original);
+    EXPECT_TRUE(tree1.set_value(5, "five"));
+    EXPECT_EQ(tree1.get_fingerprint(), original);
+    EXPECT_FALSE(tree1.set_value(42, "forty two"));
+}
+
+TEST_F(BinaryTreeTest, Fingerprint_RecomputedAfterWriteThroughReference) {
+    binary_tree<int, string> tree_copy = tree1;
+    tree_copy.get_value(3) = "три";
+
+    EXPECT_FALSE(tree_copy == tree1);
+    tree_copy.get_value(3) = "three";
+    EXPECT_EQ(tree_copy.get_fingerprint(), tree1.get_fingerprint());
+    EXPECT_TRUE(tree_copy == tree1);
+}
+
+TEST_F(BinaryTreeTest, Fingerprint_FollowsHeldReference) {
+    binary_tree<int, string> tree_copy = tree1;
+    string& held_value = tree_copy.get_value(3);
+    held_value = "три";
+    EXPECT_FALSE(tree_copy == tree1);
+
+    held_value = "three";
+    EXPECT_TRUE(tree_copy == tree1);
+    tree_copy.set_value(3, "три");
+    EXPECT_NE(tree_copy.get_fingerprint(), tree1.get_fingerprint());
+
+    auto handle = tree_copy.extract(3);
+    handle.value() = "three";
+    binary_tree<int, string> other;
+    other.insert(move(handle));
+    tree_copy.merge(other);
+    EXPECT_TRUE(tree_copy == tree1);
+    EXPECT_FALSE(tree_copy.is_value_exposed(3));
+    string& renewed_value = tree_copy.get_value(3);
+    renewed_value = "три";
+    EXPECT_FALSE(tree_copy == tree1);
+
+    tree_copy.delete_helper(3);
+    tree_copy.insert_helper(3, "three");
+    EXPECT_TRUE(tree_copy == tree1);
+}
+
+TEST_F(BinaryTreeTest, Fingerprint_ExposedNodesRemovedOnDeleteAndSetValue) {
+    binary_tree<int, string> large_tree, expected;
+    for (int i = 0; i < 100; ++i) {
+        large_tree.insert_helper(i, to_string(i));
+        expected.insert_helper(i, to_string(i));
+    }
+    for (int i = 0; i < 100; i += 2) large_tree.get_value(i) += "!";
+    for (int i = 0; i < 100; i += 4) {
+        large_tree.delete_helper(i);
+        expected.delete_helper(i);
+    }
+    for (int i = 2; i < 100; i += 4) {
+        EXPECT_TRUE(large_tree.is_value_exposed(i));
+        large_tree.set_value(i, to_string(i));
+        EXPECT_FALSE(large_tree.is_value_exposed(i));
+    }
+
+    size_t exposed_number = 0;
+    large_tree.for_each_exposed([&exposed_number](int, const string&) { exposed_number++; });
+    EXPECT_EQ(exposed_number, 0u);
+    EXPECT_EQ(large_tree.get_fingerprint(), expected.get_fingerprint());
+    EXPECT_TRUE(large_tree == expected);
+}
+
+TEST_F(BinaryTreeTest, MergeWith_FailedCopyLeavesTreeUnchanged) {
+    {
+        binary_tree<int, fragile_value> own, other;
+        for (int i = 0; i < 3; ++i) own.insert_helper(i, fragile_value(i));
+        for (int i = 10; i < 20; ++i) other.insert_helper(i, fragile_value(i));
+        int live_before = fragile_value::live_number;
+
+        fragile_value::copies_left = 5;
+        EXPECT_THROW(own.merge_with(other, [](int, const fragile_value& own_value, const fragile_value&) {
+            return own_value;
+        }), runtime_error);
+        fragile_value::copies_left = -1;
+
+        EXPECT_EQ(fragile_value::live_number, live_before);
+        EXPECT_EQ(own.get_size(), 3);
+        EXPECT_FALSE(own.contains_node(10));
+        checked_height(own.get_tree_root());
+
+        own.merge_with(other, [](int, const fragile_value& own_value, const fragile_value&) { return own_value; });
+        EXPECT_EQ(own.get_size(), 13);
+    }
+    EXPECT_EQ(fragile_value::live_number, 0);
+}
+
+TEST_F(BinaryTreeTest, Fingerprint_MatchesAfterMerge) {
+    binary_tree<int, string> expected = tree1;
+    expected.insert_helper(10, "ten");
+    expected.insert_helper(15, "fifteen");
+
+    tree1.merge_with(tree2, [](int, const string& own, const string&) { return own; });
+    EXPECT_EQ(tree1.get_fingerprint(), expected.get_fingerprint());
+}
+
+TEST_F(BinaryTreeTest, ParallelReduce_PreservesKeyOrder) {
+    binary_tree<int, string> large_tree;
+    for (int i = 0; i < 5000; ++i) large_tree.insert_helper((i * 7919) % 5000, to_string(i));
+
+    for (size_t thread_number : {1, 2, 3, 8}) {
+        vector<int> keys = large_tree.parallel_reduce(
+                vector<int>(),
+                [](vector<int>& partial, int key_, const string&) { partial.push_back(key_); },
+                [](vector<int> left, const vector<int>& right) {
+                    left.insert(left.end(), right.begin(), right.end());
+                    return left;
+                },
+                thread_number);
+        ASSERT_EQ(keys.size(), 5000);
+        for (int i = 0; i < 5000; ++i) EXPECT_EQ(keys[i], i);
+    }
+}
+
+TEST_F(BinaryTreeTest, ParallelForEach_VisitsEveryPairOnce) {
+    binary_tree<int, int> large_tree;
+    for (int i = 1; i <= 10000; ++i) large_tree.insert_helper(i, i);
+    atomic<long long> sum(0);
+    atomic<int> visited(0);
+
+    large_tree.parallel_for_each([&](int, int value_) {
+        sum += value_;
+        visited++;
+    }, 4);
+
+    EXPECT_EQ(visited, 10000);
+    EXPECT_EQ(sum, 10000LL * 10001 / 2);
+}
+
+TEST_F(BinaryTreeTest, ParallelOperations_EmptyTreeAndExceptions) {
+    int calls = 0;
+    empty_tree.parallel_for_each([&calls](int, const string&) { calls++; }, 4);
+    EXPECT_EQ(calls, 0);
+    EXPECT_EQ(empty_tree.parallel_reduce(0, [](int& partial, int, const string&) { partial++; },
+                                         [](int left, int right) { return left + right; }), 0);
+
+    binary_tree<int, int> large_tree;
+    for (int i = 0; i < 1000; ++i) large_tree.insert_helper(i, i);
+    EXPECT_THROW(large_tree.parallel_for_each([](int key_, int) {
+        if (key_ == 500) throw runtime_error("ошибка");
+    }, 4), runtime_error);
+}
+
+TEST_F(BinaryTreeTest, MoveAndSwap_DoNotAllocate) {
+    binary_tree<int, counted_string> source, small_tree;
+    for (int i = 0; i < 1000; ++i) source.insert_helper(i, "значение, которое не помещается в SSO");
+    small_tree.insert_helper(5, "five");
+    small_tree.insert_helper(3, "three");
+    small_tree.insert_helper(7, "seven");
+    uint64_t fingerprint = source.get_fingerprint();
+
+    size_t copies_before = counted_string::copy_counter;
+    binary_tree<int, counted_string> moved(std::move(source));
+    binary_tree<int, counted_string> assigned;
+    assigned = std::move(moved);
+    swap(assigned, small_tree);
+    EXPECT_EQ(counted_string::copy_counter - copies_before, 0u);
+
+    EXPECT_TRUE(source.empty_tree());
+    EXPECT_TRUE(moved.empty_tree());
+    EXPECT_EQ(source.get_fingerprint(), 0u);
+    EXPECT_EQ(small_tree.get_size(), 1000);
+    EXPECT_EQ(small_tree.get_fingerprint(), fingerprint);
+    EXPECT_EQ(assigned.get_size(), 3);
+    EXPECT_EQ(assigned.get_value(7), "seven");
+}
+
+TEST_F(BinaryTreeTest, ExtractInsert_MovesNodeWithoutAllocation) {
+    binary_tree<int, counted_string> large_tree, target_tree;
+    for (int i = 0; i < 100; ++i) large_tree.insert_helper(i, "значение номер " + to_string(i));
+
+    size_t copies_before = counted_string::copy_counter;
+    auto handle = large_tree.extract(42);
+    bool inserted = target_tree.insert(std::move(handle));
+    auto missing = large_tree.extract(1000);
+    EXPECT_EQ(counted_string::copy_counter - copies_before, 0u);
+
+    EXPECT_TRUE(inserted);
+    EXPECT_TRUE(handle.empty());
+    EXPECT_TRUE(missing.empty());
+    EXPECT_FALSE(large_tree.contains_node(42));
+    EXPECT_EQ(large_tree.get_size(), 99);
+    EXPECT_EQ(target_tree.get_value(42), "значение номер 42");
+    checked_height(large_tree.get_tree_root());
+
+    auto duplicate = tree2.extract(5);
+    duplicate.value() = "пять";
+    EXPECT_FALSE(tree1.insert(std::move(duplicate)));
+    EXPECT_EQ(duplicate.key(), 5);
+    EXPECT_THROW(missing.key(), out_of_range);
+
+    binary_tree<int, string> expected;
+    expected.insert_helper(10, "ten");
+    expected.insert_helper(15, "fifteen");
+    EXPECT_EQ(tree2.get_fingerprint(), expected.get_fingerprint());
+    EXPECT_TRUE(tree2 == expected);
+}
+
+TEST_F(BinaryTreeTest, Merge_SplicesNodesWithoutAllocation) {
+    binary_tree<int, counted_string> own, other;
+    for (int i = 0; i < 2000; i += 2) own.insert_helper(i, "свой " + to_string(i));
+    for (int i = 0; i < 2000; i += 3) other.insert_helper(i, "чужой " + to_string(i));
+    binary_tree<int, counted_string> expected(own);
+    expected.merge_with(other, [](int, const counted_string& own_value, const counted_string&) { return own_value; });
+
+    size_t copies_before = counted_string::copy_counter;
+    own.merge(other);
+    EXPECT_EQ(counted_string::copy_counter - copies_before, 0u);
+
+    EXPECT_TRUE(own == expected);
+    checked_height(own.get_tree_root());
+    checked_height(other.get_tree_root());
+    EXPECT_EQ(other.get_size(), 334);
+    other.inorder_traverse([](int key_, const counted_string&) { EXPECT_EQ(key_ % 6, 0); });
+    uint64_t fingerprint = other.get_fingerprint();
+    binary_tree<int, counted_string> recomputed(other);
+    recomputed.get_value(0);
+    EXPECT_EQ(recomputed.get_fingerprint(), fingerprint);
+}
@@ -2,6 +2,7 @@
 #include <sstream>
 #include <fstream>
 #include <cstdio>
+#include <thread>
 #include "Dictionary.h"
 
 class DictionaryTest : public ::testing::Test {
@@ -293,3 +294,279 @@ TEST_F(DictionaryTest, EdgeCases_EmptyStringOperations) {
 TEST_F(DictionaryTest, OperatorPlusEquals_DuplicateWordThrows) {
     EXPECT_THROW(dict1 += std::make_pair("apple", "яблоко"), std::invalid_argument);
 }
+
+TEST_F(DictionaryTest, OperatorEquals_SameContentDifferentInsertionOrder_ReturnsTrue) {
+    dictionary forward, backward;
+    const char* words[] = {"ant", "bee", "cat", "dog", "eel", "fox", "gnu"};
+    for (const char* word : words) forward += std::make_pair(word, "зверь");
+    for (int i = 6; i >= 0; --i) backward += std::make_pair(words[i], "зверь");
+
+    EXPECT_TRUE(forward == backward);
+}
+
+TEST_F(DictionaryTest, Diff_ReportsAddedRemovedAndChangedInOrder) {
+    dict2 -= "apple";
+    dict2["book"] = "книжка";
+    dict2 += std::make_pair("cat", "кот");
+
+    std::vector<dictionary_change> changes = dict1.diff(dict2);
+
+    ASSERT_EQ(changes.size(), 3);
+    EXPECT_EQ(changes[0].type, dictionary_change::removed);
+    EXPECT_EQ(changes[0].english_word, "apple");
+    EXPECT_EQ(changes[1].type, dictionary_change::changed);
+    EXPECT_EQ(changes[1].old_translation, "книга");
+    EXPECT_EQ(changes[1].new_translation, "книжка");
+    EXPECT_EQ(changes[2].type, dictionary_change::added);
+    EXPECT_EQ(changes[2].english_word, "cat");
+}
+
+TEST_F(DictionaryTest, Diff_EqualDictionaries_ReturnsNothing) {
+    EXPECT_TRUE(dict1.diff(dict2).empty());
+    EXPECT_EQ(empty_dict.diff(dict1).size(), 2);
+}
+
+TEST_F(DictionaryTest, ApplyChanges_TransformsIntoOtherDictionary) {
+    dict2 -= "apple";
+    dict2["book"] = "книжка";
+    dict2 += std::make_pair("cat", "кот");
+
+    dict1.apply_changes(dict1.diff(dict2));
+    EXPECT_TRUE(dict1 == dict2);
+}
+
+TEST_F(DictionaryTest, Merge_KeepOwnAndTakeOtherPolicies) {
+    dictionary other;
+    other += std::make_pair("apple", "яблочко");
+    other += std::make_pair("cat", "кот");
+
+    dictionary kept = dict1;
+    kept.merge(other);
+    EXPECT_EQ(kept.get_size(), 3);
+    EXPECT_EQ(kept["apple"], "яблоко");
+
+    dict1.merge(other, merge_policy::take_other);
+    EXPECT_EQ(dict1.get_size(), 3);
+    EXPECT_EQ(dict1["apple"], "яблочко");
+    EXPECT_EQ(dict1["cat"], "кот");
+    EXPECT_EQ(other.get_size(), 2);
+}
+
+TEST_F(DictionaryTest, SetTranslation_UpdatesValueAndFingerprint) {
+    uint64_t original = dict1.get_fingerprint();
+    EXPECT_EQ(original, dict2.get_fingerprint());
+
+    dict1.set_translation("book", "книжка");
+    EXPECT_EQ(dict1["book"], "книжка");
+    EXPECT_NE(dict1.get_fingerprint(), original);
+    EXPECT_FALSE(dict1 == dict2);
+    EXPECT_THROW(dict1.set_translation("missing", "нет"), std::out_of_range);
+}
+
+TEST_F(DictionaryTest, KeyFilter_DoesNotChangeLookupResults) {
+    dictionary filtered;
+    for (int i = 0; i < 3000; ++i) {
+        filtered += std::make_pair("word" + std::to_string(i), std::string("слово"));
+    }
+    filtered.enable_key_filter();
+    EXPECT_TRUE(filtered.has_key_filter());
+    EXPECT_GT(filtered.get_key_filter_memory(), 0);
+
+    for (int i = 0; i < 3000; ++i) {
+        EXPECT_TRUE(filtered.contains_word("word" + std::to_string(i)));
+        EXPECT_FALSE(filtered.contains_word("missing" + std::to_string(i)));
+    }
+
+    for (int i = 3000; i < 10000; ++i) {
+        filtered += std::make_pair("word" + std::to_string(i), std::string("слово"));
+    }
+    for (int i = 0; i < 5000; ++i) {
+        filtered -= "word" + std::to_string(i);
+    }
+    for (int i = 0; i < 10000; ++i) {
+        EXPECT_EQ(filtered.contains_word("word" + std::to_string(i)), i >= 5000);
+    }
+
+    filtered.disable_key_filter();
+    EXPECT_FALSE(filtered.has_key_filter());
+    EXPECT_EQ(filtered.get_key_filter_memory(), 0);
+    EXPECT_TRUE(filtered.contains_word("word9999"));
+}
+
+TEST_F(DictionaryTest, KeyFilter_FollowsMergeAndChanges) {
+    dictionary filtered;
+    filtered += std::make_pair("apple", "яблоко");
+    filtered.enable_key_filter(0.01, false);
+
+    dictionary other;
+    other += std::make_pair("book", "книга");
+    filtered.merge(other);
+    EXPECT_TRUE(filtered.contains_word("book"));
+
+    filtered.apply_changes({{dictionary_change::added, "cat", "", "кошка"},
+                            {dictionary_change::removed, "apple", "яблоко", ""}});
+    EXPECT_TRUE(filtered.contains_word("cat"));
+    EXPECT_FALSE(filtered.contains_word("apple"));
+
+    dictionary copy = filtered;
+    EXPECT_TRUE(copy.has_key_filter());
+    EXPECT_TRUE(copy.contains_word("cat"));
+}
+
+TEST_F(DictionaryTest, ExportTo_PlainMatchesStreamOperator) {
+    dictionary dict;
+    for (int i = 0; i < 20000; ++i) dict += std::make_pair("word" + std::to_string(i), std::string("слово"));
+    std::ostringstream expected, exported;
+    expected << dict;
+
+    EXPECT_EQ(dict.export_to(exported), 20000);
+    EXPECT_EQ(exported.str(), expected.str());
+}
+
+TEST_F(DictionaryTest, ExportTo_TsvAndJsonLinesEscapeSpecialCharacters) {
+    dictionary dict;
+    dict += std::make_pair("apple", "яблоко");
+    dict += std::make_pair("quote", "\"кавычки\"\tи\\слеш");
+    std::ostringstream tsv, json_lines;
+
+    dict.export_to(tsv, export_format::tsv);
+    dict.export_to(json_lines, export_format::json_lines);
+
+    EXPECT_EQ(tsv.str(), "apple\tяблоко\nquote\t\"кавычки\"\\tи\\\\слеш\n");
+    EXPECT_EQ(json_lines.str(), "{\"english\":\"apple\",\"russian\":\"яблоко\"}\n"
+                                "{\"english\":\"quote\",\"russian\":\"\\\"кавычки\\\"\\tи\\\\слеш\"}\n");
+}
+
+TEST_F(DictionaryTest, ExportTo_EmptyDictionaryWritesNothing) {
+    dictionary dict;
+    std::ostringstream exported;
+    EXPECT_EQ(dict.export_to(exported, export_format::json_lines), 0);
+    EXPECT_TRUE(exported.str().empty());
+}
+
+TEST_F(DictionaryTest, SpliceAndMove_TransferWordsAndKeepKeyFilter) {
+    dictionary own, other;
+    own += std::make_pair("apple", "яблоко");
+    other += std::make_pair("apple", "другое");
+    other += std::make_pair("book", "книга");
+    own.enable_key_filter();
+
+    own.splice(other);
+    EXPECT_EQ(own.get_size(), 2);
+    EXPECT_EQ(own["apple"], "яблоко");
+    EXPECT_TRUE(own.contains_word("book"));
+    EXPECT_EQ(other.get_size(), 1);
+    EXPECT_EQ(other["apple"], "другое");
+
+    dictionary moved(std::move(own));
+    EXPECT_TRUE(own.is_empty());
+    EXPECT_FALSE(own.has_key_filter());
+    EXPECT_FALSE(own.contains_word("book"));
+    EXPECT_TRUE(moved.has_key_filter());
+    EXPECT_TRUE(moved.contains_word("book"));
+
+    moved.swap(other);
+    EXPECT_EQ(moved.get_size(), 1);
+    EXPECT_FALSE(moved.has_key_filter());
+    EXPECT_EQ(other.get_size(), 2);
+    EXPECT_TRUE(other.has_key_filter());
+}
+
+TEST_F(DictionaryTest, MemoryUsage_IncrementalMatchesFullRecount) {
+    dictionary dict;
+    const std::string long_translation = "перевод, который не помещается во внутренний буфер";
+    dict += std::make_pair("cat", "кот");
+    memory_usage_report first = dict.memory_usage();
+    EXPECT_EQ(first.word_number, 1u);
+    EXPECT_EQ(first.key_heap_bytes, 0u);
+    EXPECT_GT(first.node_bytes, 2 * sizeof(std::string));
+    EXPECT_GT(first.allocator_overhead_bytes, 0u);
+
+    for (int i = 0; i < 300; ++i) {
+        dict += std::make_pair(std::string(1 + i % 40, 'a') + std::to_string(i), i % 2 ? long_translation : "слово");
+    }
+    for (int i = 0; i < 300; i += 3) dict -= std::string(1 + i % 40, 'a') + std::to_string(i);
+    dict.set_translation("cat", long_translation);
+    dict.apply_changes({{dictionary_change::added, "dog", "", long_translation},
+                        {dictionary_change::removed, "cat", long_translation, ""}});
+    memory_usage_report incremental = dict.memory_usage();
+
+    dictionary empty;
+    dict.splice(empty);
+    memory_usage_report recounted = dict.memory_usage();
+    EXPECT_EQ(incremental.word_number, 201u);
+    EXPECT_EQ(incremental.node_bytes, recounted.node_bytes);
+    EXPECT_EQ(incremental.key_heap_bytes, recounted.key_heap_bytes);
+    EXPECT_EQ(incremental.value_heap_bytes, recounted.value_heap_bytes);
+    EXPECT_EQ(incremental.allocator_overhead_bytes, recounted.allocator_overhead_bytes);
+    EXPECT_EQ(incremental.key_length_histogram, recounted.key_length_histogram);
+    EXPECT_GT(recounted.key_heap_bytes, 0u);
+    EXPECT_GE(recounted.value_heap_bytes, 100 * (long_translation.size() + 1));
+    EXPECT_EQ(recounted.total_bytes(), recounted.node_bytes + recounted.key_heap_bytes +
+                                       recounted.value_heap_bytes + recounted.allocator_overhead_bytes);
+}
+
+TEST_F(DictionaryTest, MemoryUsage_CopyIsCountedAndConstCallsAgree) {
+    dictionary source;
+    for (int i = 0; i < 200; ++i) {
+        source += std::make_pair("word" + std::to_string(i), "перевод, который не помещается во внутренний буфер");
+    }
+    const dictionary shared_copy(source);
+    memory_usage_report first, second;
+    std::thread first_reader([&] { first = shared_copy.memory_usage(); });
+    std::thread second_reader([&] { second = shared_copy.memory_usage(); });
+    first_reader.join();
+    second_reader.join();
+
+    EXPECT_EQ(first.word_number, 200u);
+    EXPECT_EQ(first.value_heap_bytes, second.value_heap_bytes);
+    EXPECT_EQ(first.key_length_histogram, second.key_length_histogram);
+    EXPECT_EQ(first.value_heap_bytes, source.memory_usage().value_heap_bytes);
+}
+
+TEST_F(DictionaryTest, MemoryUsage_FollowsHeldReference) {
+    dictionary dict;
+    dict += std::make_pair("cat", "кот");
+    dict += std::make_pair("dog", "собака");
+    memory_usage_report before = dict.memory_usage();
+
+    std::string& held_translation = dict["cat"];
+    EXPECT_EQ(dict.memory_usage().value_heap_bytes, before.value_heap_bytes);
+    held_translation = std::string(200, 'x');
+    memory_usage_report after = dict.memory_usage();
+    EXPECT_EQ(after.value_heap_bytes, before.value_heap_bytes + held_translation.capacity() + 1);
+    EXPECT_EQ(after.word_number, 2u);
+
+    dict.set_translation("cat", "кот");
+    dict -= "dog";
+    dictionary empty;
+    dict.splice(empty);
+    EXPECT_EQ(dict.memory_usage().value_heap_bytes, held_translation.capacity() + 1);
+    dict.set_translation("cat", std::string(300, 'y'));
+    EXPECT_EQ(dict.memory_usage().value_heap_bytes, held_translation.capacity() + 1);
+    EXPECT_EQ(dict.memory_usage().key_length_histogram, std::vector<size_t>({0, 0, 0, 1}));
+}
+
+TEST_F(DictionaryTest, MemoryUsage_HistogramAndKeyFilter) {
+    dictionary dict;
+    dict += std::make_pair("a", "а");
+    dict += std::make_pair("be", "быть");
+    dict += std::make_pair("go", "идти");
+    dict += std::make_pair(std::string(100, 'x'), std::string("длинное"));
+    dict.enable_key_filter();
+
+    memory_usage_report report = dict.memory_usage();
+    ASSERT_EQ(report.key_length_histogram.size(), memory_usage_report::key_length_limit + 1);
+    EXPECT_EQ(report.key_length_histogram[1], 1u);
+    EXPECT_EQ(report.key_length_histogram[2], 2u);
+    EXPECT_EQ(report.key_length_histogram[memory_usage_report::key_length_limit], 1u);
+    EXPECT_EQ(report.key_filter_bytes, dict.get_key_filter_memory());
+
+    dict -= std::string(100, 'x');
+    EXPECT_EQ(dict.memory_usage().key_length_histogram.size(), 3u);
+
+    std::ostringstream output;
+    output << dict.memory_usage();
+    EXPECT_NE(output.str().find("Слов: 3"), std::string::npos);
+    EXPECT_NE(output.str().find("  2: 2\n"), std::string::npos);
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <fstream>
+#include <cstdio>
+#include "Journaled_dictionary.h"
+#include "Write_ahead_log.h"
+
+class JournaledDictionaryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        remove_files();
+    }
+
+    void TearDown() override {
+        remove_files();
+    }
+
+    void remove_files() {
+        std::remove(snapshot_file.c_str());
+        std::remove(journal_file.c_str());
+    }
+
+    const std::string snapshot_file = "journal_test_snapshot.txt";
+    const std::string journal_file = "journal_test_journal.log";
+};
+
+TEST_F(JournaledDictionaryTest, Changes_SurviveReopenWithoutCheckpoint) {
+    {
+        journaled_dictionary dict(snapshot_file, journal_file);
+        dict += std::make_pair("apple", "яблоко");
+        dict += std::make_pair("book", "книга");
+        dict += std::make_pair("cat", "кошка");
+        dict -= "book";
+        dict.set_translation("cat", "кот");
+    }
+    journaled_dictionary reopened(snapshot_file, journal_file);
+
+    EXPECT_EQ(reopened.get_dictionary().get_size(), 2);
+    EXPECT_EQ(reopened["apple"], "яблоко");
+    EXPECT_EQ(reopened["cat"], "кот");
+    EXPECT_FALSE(reopened.contains_word("book"));
+    EXPECT_EQ(reopened.get_journal_length(), 5);
+}
+
+TEST_F(JournaledDictionaryTest, Checkpoint_WritesSnapshotAndClearsJournal) {
+    {
+        journaled_dictionary dict(snapshot_file, journal_file);
+        dict += std::make_pair("apple", "яблоко");
+        dict += std::make_pair("dog", "собака");
+        dict.checkpoint();
+        EXPECT_EQ(dict.get_journal_length(), 0);
+        dict -= "dog";
+    }
+    std::ifstream snapshot(snapshot_file, std::ios::binary);
+    std::uintmax_t valid_bytes = 0;
+    EXPECT_EQ(write_ahead_log::read_records(snapshot, [](bool, const std::string&, const std::string&) {}, valid_bytes), 2);
+
+    journaled_dictionary reopened(snapshot_file, journal_file);
+    EXPECT_EQ(reopened.get_dictionary().get_size(), 1);
+    EXPECT_EQ(reopened.get_journal_length(), 1);
+}
+
+TEST_F(JournaledDictionaryTest, Checkpoint_KeepsValuesUnchanged) {
+    const std::string odd_translation = "tab\there\nnew line \\ back";
+    {
+        journaled_dictionary dict(snapshot_file, journal_file);
+        dict += std::make_pair("apple", "яблоко, фрукт");
+        dict += std::make_pair("Bob", "боб");
+        dict += std::make_pair("tea", "tea2");
+        dict += std::make_pair("odd\tkey", odd_translation);
+        dict.checkpoint();
+        dict += std::make_pair("journaled\\", odd_translation);
+    }
+    journaled_dictionary reopened(snapshot_file, journal_file);
+
+    EXPECT_EQ(reopened.get_journal_length(), 1);
+    EXPECT_EQ(reopened.get_dictionary().get_size(), 5);
+    EXPECT_EQ(reopened["journaled\\"], odd_translation);
+    EXPECT_EQ(reopened["apple"], "яблоко, фрукт");
+    EXPECT_EQ(reopened["Bob"], "боб");
+    EXPECT_EQ(reopened["tea"], "tea2");
+    EXPECT_EQ(reopened["odd\tkey"], odd_translation);
+}
+
+TEST_F(JournaledDictionaryTest, Snapshot_ReadsOldFormatAndRejectsDamage) {
+    {
+        std::ofstream snapshot(snapshot_file, std::ios::binary);
+        snapshot << "apple - яблоко\n";
+    }
+    {
+        journaled_dictionary dict(snapshot_file, journal_file);
+        EXPECT_EQ(dict["apple"], "яблоко");
+        dict.checkpoint();
+    }
+    {
+        std::ofstream snapshot(snapshot_file, std::ios::binary | std::ios::app);
+        snapshot << "P\tbook\tкнига\t00000000\n";
+    }
+    EXPECT_THROW(journaled_dictionary(snapshot_file, journal_file), std::runtime_error);
+}
+
+TEST_F(JournaledDictionaryTest, AutomaticCheckpoint_BoundsJournalLength) {
+    journaled_dictionary dict(snapshot_file, journal_file, 1, 3);
+    dict += std::make_pair("one", "один");
+    dict += std::make_pair("two", "два");
+    EXPECT_EQ(dict.get_journal_length(), 2);
+    dict += std::make_pair("three", "три");
+    EXPECT_EQ(dict.get_journal_length(), 0);
+}
+
+TEST_F(JournaledDictionaryTest, InvalidOperations_AreNotJournaled) {
+    journaled_dictionary dict(snapshot_file, journal_file);
+    dict += std::make_pair("apple", "яблоко");
+
+    EXPECT_THROW(dict += std::make_pair("apple", "другое"), std::invalid_argument);
+    EXPECT_THROW(dict -= "missing", std::invalid_argument);
+    EXPECT_THROW(dict.set_translation("missing", "нет"), std::out_of_range);
+    EXPECT_EQ(dict.get_journal_length(), 1);
+}
+
+TEST_F(JournaledDictionaryTest, CorruptedRecord_StopsReplayAndIsDiscarded) {
+    {
+        journaled_dictionary dict(snapshot_file, journal_file);
+        dict += std::make_pair("apple", "яблоко");
+    }
+    {
+        std::ofstream journal(journal_file, std::ios::binary | std::ios::app);
+        journal << "P\tbook\tкнига\t00000000\n";
+    }
+    {
+        journaled_dictionary reopened(snapshot_file, journal_file);
+        EXPECT_FALSE(reopened.contains_word("book"));
+        reopened += std::make_pair("cat", "кот");
+    }
+    journaled_dictionary reopened(snapshot_file, journal_file);
+
+    EXPECT_TRUE(reopened.contains_word("apple"));
+    EXPECT_TRUE(reopened.contains_word("cat"));
+    EXPECT_FALSE(reopened.contains_word("book"));
+}
+
+TEST(WriteAheadLogTest, Checksum_MatchesKnownValue) {
+    EXPECT_EQ(write_ahead_log::checksum("123456789"), 0xCBF43926u);
+}
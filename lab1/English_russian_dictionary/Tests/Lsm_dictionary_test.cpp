@@ -0,0 +1,257 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include "Lsm_dictionary.h"
+#include "Bloom_filter.h"
+
+class LsmDictionaryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    const std::string directory = "lsm_test_directory";
+};
+
+TEST_F(LsmDictionaryTest, AddAndFind_InMemtable_ReturnsTranslation) {
+    lsm_dictionary dict(directory);
+    dict += std::make_pair("apple", "яблоко");
+
+    EXPECT_TRUE(dict.contains_word("apple"));
+    EXPECT_FALSE(dict.contains_word("book"));
+    EXPECT_EQ(dict["apple"], "яблоко");
+    EXPECT_THROW(dict["book"], std::out_of_range);
+}
+
+TEST_F(LsmDictionaryTest, AddExistingWord_ThrowsException) {
+    lsm_dictionary dict(directory);
+    dict += std::make_pair("apple", "яблоко");
+
+    EXPECT_THROW(dict += std::make_pair("apple", "другое"), std::invalid_argument);
+}
+
+TEST_F(LsmDictionaryTest, DeleteWord_HidesOlderRunValue) {
+    lsm_dictionary dict(directory, 2);
+    dict += std::make_pair("apple", "яблоко");
+    dict += std::make_pair("book", "книга");
+    EXPECT_EQ(dict.get_run_count(), 1);
+
+    dict -= "apple";
+    EXPECT_FALSE(dict.contains_word("apple"));
+    EXPECT_THROW(dict -= "apple", std::invalid_argument);
+    EXPECT_EQ(dict.get_size(), 1);
+}
+
+TEST_F(LsmDictionaryTest, SetTranslation_OverridesRunValue) {
+    lsm_dictionary dict(directory, 1);
+    dict += std::make_pair("cat", "кошка");
+    dict.set_translation("cat", "кот");
+
+    EXPECT_EQ(dict["cat"], "кот");
+    EXPECT_THROW(dict.set_translation("dog", "собака"), std::out_of_range);
+}
+
+TEST_F(LsmDictionaryTest, CrashRecovery_ReplaysWriteAheadLog) {
+    {
+        lsm_dictionary dict(directory);
+        dict += std::make_pair("apple", "яблоко");
+        dict += std::make_pair("book", "книга");
+        dict -= "book";
+        dict.set_translation("apple", "яблоня");
+    }
+    lsm_dictionary reopened(directory);
+
+    EXPECT_EQ(reopened["apple"], "яблоня");
+    EXPECT_FALSE(reopened.contains_word("book"));
+    EXPECT_EQ(reopened.get_size(), 1);
+}
+
+TEST_F(LsmDictionaryTest, CrashRecovery_IgnoresTornLastRecord) {
+    {
+        lsm_dictionary dict(directory);
+        dict += std::make_pair("apple", "яблоко");
+    }
+    {
+        std::ofstream wal(directory + "/wal.log", std::ios::binary | std::ios::app);
+        wal << "P\tbook\tкн";
+    }
+    lsm_dictionary reopened(directory);
+
+    EXPECT_TRUE(reopened.contains_word("apple"));
+    EXPECT_FALSE(reopened.contains_word("book"));
+}
+
+TEST_F(LsmDictionaryTest, CrashRecovery_RestoresRunsAndMemtable) {
+    {
+        lsm_dictionary dict(directory, 3);
+        for (char letter = 'a'; letter <= 'j'; ++letter) {
+            dict += std::make_pair(std::string(2, letter), "слово");
+        }
+    }
+    lsm_dictionary reopened(directory, 3);
+
+    EXPECT_EQ(reopened.get_size(), 10);
+    for (char letter = 'a'; letter <= 'j'; ++letter) {
+        EXPECT_TRUE(reopened.contains_word(std::string(2, letter)));
+    }
+}
+
+TEST_F(LsmDictionaryTest, CrashRecovery_ReopensCopyTakenWithoutShutdown) {
+    const std::string crashed_directory = directory + "_crashed";
+    std::filesystem::remove_all(crashed_directory);
+    {
+        lsm_dictionary dict(directory, 3, 100, 1);
+        for (char letter = 'a'; letter <= 'g'; ++letter) {
+            dict += std::make_pair(std::string(2, letter), "слово");
+        }
+        dict -= "aa";
+        ASSERT_EQ(dict.get_run_count(), 2);
+        std::filesystem::copy(directory, crashed_directory, std::filesystem::copy_options::recursive);
+    }
+    {
+        std::ofstream wal(crashed_directory + "/wal.log", std::ios::binary | std::ios::app);
+        wal << "D	bb";
+    }
+    {
+        lsm_dictionary reopened(crashed_directory, 3, 100, 1);
+
+        EXPECT_EQ(reopened.get_size(), 6);
+        EXPECT_FALSE(reopened.contains_word("aa"));
+        EXPECT_TRUE(reopened.contains_word("bb"));
+        EXPECT_TRUE(reopened.contains_word("gg"));
+    }
+    std::filesystem::remove_all(crashed_directory);
+}
+
+TEST_F(LsmDictionaryTest, Compact_FailureIsReportedAndRunsStayIntact) {
+    lsm_dictionary dict(directory, 1, 100);
+    dict += std::make_pair("apple", "яблоко");
+    dict += std::make_pair("book", "книга");
+    ASSERT_EQ(dict.get_run_count(), 2);
+    std::filesystem::create_directory(directory + "/run_2.txt.tmp");
+
+    EXPECT_THROW(dict.compact(), std::runtime_error);
+    EXPECT_EQ(dict.get_run_count(), 2);
+    EXPECT_EQ(dict["book"], "книга");
+
+    std::filesystem::remove(directory + "/run_2.txt.tmp");
+    dict.compact();
+    EXPECT_EQ(dict.get_run_count(), 1);
+    EXPECT_EQ(dict["apple"], "яблоко");
+    EXPECT_EQ(dict["book"], "книга");
+}
+
+TEST_F(LsmDictionaryTest, Runs_KeepTabsAndNewlinesInWordsAndTranslations) {
+    const std::string tricky_word = "two\twords\nD\tapple";
+    const std::string tricky_translation = "x\nD\tapple\\n";
+    {
+        lsm_dictionary dict(directory, 2, 100);
+        dict += std::make_pair("apple", "яблоко");
+        dict += std::make_pair(tricky_word, "слово");
+        dict += std::make_pair("book", tricky_translation);
+        dict += std::make_pair("zebra", "зебра");
+        dict.flush();
+        EXPECT_GT(dict.get_run_count(), 1);
+        dict.compact();
+        EXPECT_EQ(dict.get_run_count(), 1);
+    }
+    lsm_dictionary reopened(directory, 2, 100);
+
+    EXPECT_EQ(reopened.get_size(), 4);
+    EXPECT_EQ(reopened["apple"], "яблоко");
+    EXPECT_EQ(reopened[tricky_word], "слово");
+    EXPECT_EQ(reopened["book"], tricky_translation);
+    EXPECT_EQ(reopened["zebra"], "зебра");
+}
+
+TEST_F(LsmDictionaryTest, Runs_DamagedRecordIsReported) {
+    {
+        lsm_dictionary dict(directory, 2);
+        dict += std::make_pair("apple", "яблоко");
+        dict += std::make_pair("book", "книга");
+    }
+    {
+        std::ofstream run(directory + "/run_0.txt", std::ios::binary | std::ios::app);
+        run << "D\tapple\n";
+    }
+    EXPECT_THROW(lsm_dictionary reopened(directory, 2), std::runtime_error);
+}
+
+TEST_F(LsmDictionaryTest, Compact_MergesRunsAndDropsDeletions) {
+    lsm_dictionary dict(directory, 2, 100);
+    for (char letter = 'a'; letter <= 'h'; ++letter) {
+        dict += std::make_pair(std::string(1, letter), "буква");
+    }
+    dict -= "a";
+    dict -= "b";
+    dict.flush();
+    EXPECT_GT(dict.get_run_count(), 1);
+
+    dict.compact();
+    EXPECT_EQ(dict.get_run_count(), 1);
+    EXPECT_EQ(dict.get_size(), 6);
+    EXPECT_FALSE(dict.contains_word("a"));
+    EXPECT_TRUE(dict.contains_word("h"));
+}
+
+TEST_F(LsmDictionaryTest, BackgroundCompaction_KeepsAllWordsAfterReopen) {
+    {
+        lsm_dictionary dict(directory, 4, 3);
+        for (int i = 0; i < 200; ++i) {
+            dict += std::make_pair("word" + std::to_string(i), "слово");
+        }
+        dict.compact();
+        EXPECT_EQ(dict.get_run_count(), 1);
+    }
+    lsm_dictionary reopened(directory, 4, 3);
+
+    EXPECT_EQ(reopened.get_size(), 200);
+    EXPECT_TRUE(reopened.contains_word("word0"));
+    EXPECT_TRUE(reopened.contains_word("word199"));
+}
+
+TEST_F(LsmDictionaryTest, ToDictionary_ContainsAllLiveWords) {
+    lsm_dictionary dict(directory, 2);
+    dict += std::make_pair("apple", "яблоко");
+    dict += std::make_pair("book", "книга");
+    dict += std::make_pair("cat", "кот");
+    dict -= "book";
+
+    dictionary result = dict.to_dictionary();
+    EXPECT_EQ(result.get_size(), 2);
+    EXPECT_EQ(result["apple"], "яблоко");
+    EXPECT_EQ(result["cat"], "кот");
+}
+
+TEST(BloomFilterTest, AddedKeys_AreAlwaysReported) {
+    bloom_filter filter(1000, 0.01);
+    for (int i = 0; i < 1000; ++i) filter.add("key" + std::to_string(i));
+    for (int i = 0; i < 1000; ++i) EXPECT_TRUE(filter.possibly_contains("key" + std::to_string(i)));
+}
+
+TEST(BloomFilterTest, MissingKeys_FalsePositiveRateIsLow) {
+    bloom_filter filter(1000, 0.01);
+    for (int i = 0; i < 1000; ++i) filter.add("key" + std::to_string(i));
+    int false_positives = 0;
+    for (int i = 0; i < 10000; ++i) {
+        if (filter.possibly_contains("missing" + std::to_string(i))) false_positives++;
+    }
+    EXPECT_LT(false_positives, 500);
+}
+
+TEST(BloomFilterTest, BlockedFilter_HasNoFalseNegatives) {
+    bloom_filter filter(5000, 0.01, true);
+    EXPECT_TRUE(filter.is_blocked_filter());
+    EXPECT_EQ(filter.get_bit_number() % 512, 0);
+    for (int i = 0; i < 5000; ++i) filter.add("key" + std::to_string(i));
+    for (int i = 0; i < 5000; ++i) EXPECT_TRUE(filter.possibly_contains("key" + std::to_string(i)));
+
+    int false_positives = 0;
+    for (int i = 0; i < 10000; ++i) false_positives += filter.possibly_contains("other" + std::to_string(i));
+    EXPECT_LT(false_positives, 500);
+}
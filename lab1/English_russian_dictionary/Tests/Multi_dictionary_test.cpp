@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <vector>
+#include "Multi_dictionary.h"
+#include "Translation_list.h"
+
+TEST(TranslationListTest, AppendRemoveAndIndex) {
+    translation_list translations("ключ");
+    EXPECT_EQ(translations.size(), 1u);
+    EXPECT_EQ(translations.primary(), "ключ");
+
+    EXPECT_TRUE(translations.append("клавиша"));
+    EXPECT_TRUE(translations.append("родник"));
+    EXPECT_FALSE(translations.append("ключ"));
+    EXPECT_EQ(translations.size(), 3u);
+    EXPECT_EQ(translations[1], "клавиша");
+    EXPECT_EQ(translations[2], "родник");
+    EXPECT_THROW(translations[3], std::out_of_range);
+    EXPECT_THROW(translations.append(std::string("a\0b", 3)), std::invalid_argument);
+
+    EXPECT_TRUE(translations.remove("родник"));
+    EXPECT_TRUE(translations.remove("ключ"));
+    EXPECT_FALSE(translations.remove("ключ"));
+    EXPECT_EQ(translations.to_vector(), std::vector<std::string>{"клавиша"});
+    EXPECT_EQ(translations.primary(), "клавиша");
+
+    EXPECT_TRUE(translations.remove("клавиша"));
+    EXPECT_TRUE(translations.empty());
+    EXPECT_EQ(translations.primary(), "");
+    EXPECT_TRUE(translations.append("ключ"));
+    EXPECT_EQ(translations, translation_list("ключ"));
+}
+
+TEST(TranslationListTest, ShortSingleTranslation_UsesNoHeap) {
+    translation_list translations("кот");
+    EXPECT_EQ(translations.heap_bytes(), 0u);
+    EXPECT_LE(sizeof(translation_list), sizeof(std::string) + 8);
+}
+
+TEST(MultiDictionaryTest, StreamInput_KeepsAlternativeTranslations) {
+    multi_dictionary dict;
+    std::istringstream input("key ключ\nkey клавиша\nkey ключ\nlook after - присматривать за\n"
+                             "look after - заботиться\nwrong\n");
+    input >> dict;
+
+    EXPECT_EQ(dict.get_size(), 2);
+    EXPECT_EQ(dict.get_translation_number(), 4u);
+    EXPECT_EQ(dict["key"].to_vector(), (std::vector<std::string>{"ключ", "клавиша"}));
+    EXPECT_EQ(dict["look after"][1], "заботиться");
+    EXPECT_THROW(dict["wrong"], std::out_of_range);
+
+    std::ostringstream output;
+    output << dict;
+    EXPECT_EQ(output.str(), "1. key - ключ, клавиша\n2. look after - присматривать за, заботиться\n");
+}
+
+TEST(MultiDictionaryTest, AppendAndRemove_KeepFingerprintAndCounts) {
+    multi_dictionary dict;
+    dict += std::make_pair("run", "бежать");
+    EXPECT_THROW(dict += std::make_pair("run", "бежать"), std::invalid_argument);
+    EXPECT_EQ(dict.append_translations("run", {"управлять", "бежать", "работать"}), 2u);
+    EXPECT_EQ(dict.get_translation_number(), 3u);
+
+    multi_dictionary same;
+    same.append_translations("run", {"бежать", "управлять", "работать"});
+    EXPECT_EQ(dict.get_fingerprint(), same.get_fingerprint());
+    EXPECT_TRUE(dict == same);
+
+    EXPECT_TRUE(dict.remove_translation("run", "управлять"));
+    EXPECT_FALSE(dict.remove_translation("run", "управлять"));
+    EXPECT_TRUE(dict != same);
+    EXPECT_TRUE(dict.remove_translation("run", "бежать"));
+    EXPECT_TRUE(dict.remove_translation("run", "работать"));
+    EXPECT_FALSE(dict.contains_word("run"));
+    EXPECT_TRUE(dict.is_empty());
+    EXPECT_EQ(dict.get_translation_number(), 0u);
+
+    same -= "run";
+    EXPECT_THROW(same -= "run", std::invalid_argument);
+    EXPECT_EQ(same.get_translation_number(), 0u);
+}
+
+TEST(MultiDictionaryTest, FileRoundTrip_AndPrimaryForDictionary) {
+    multi_dictionary dict;
+    dict.append_translations("key", {"ключ", "клавиша"});
+    dict.add_translation("cat", "кошка");
+    const std::string file_name = "multi_dictionary_test.txt";
+    ASSERT_TRUE(dict.write_to_file(file_name));
+
+    multi_dictionary loaded;
+    loaded.read_from_file(file_name);
+    EXPECT_TRUE(loaded == dict);
+
+    dictionary primary;
+    primary.read_from_file(file_name);
+    EXPECT_TRUE(primary == dict.to_dictionary());
+    EXPECT_EQ(primary["key"], "ключ");
+    std::remove(file_name.c_str());
+}
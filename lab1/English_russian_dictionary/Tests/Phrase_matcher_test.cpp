@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <sstream>
+#include "Phrase_matcher.h"
+#include "Dictionary.h"
+
+class PhraseMatcherTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        dict += std::make_pair("look", "смотреть");
+        dict += std::make_pair("look after", "присматривать за");
+        dict += std::make_pair("after", "после");
+        dict += std::make_pair("cat", "кошка");
+        dict += std::make_pair("give up", "сдаваться");
+    }
+
+    dictionary dict;
+};
+
+TEST_F(PhraseMatcherTest, FindAll_ReportsNestedAndOverlappingPhrases) {
+    phrase_matcher matcher(dict);
+    std::string text = "Please look after the cat.";
+    auto matches = matcher.find_all(text);
+
+    ASSERT_EQ(matches.size(), 4);
+    EXPECT_EQ(matches[0].english_phrase, "look");
+    EXPECT_EQ(matches[0].position, 7);
+    EXPECT_EQ(matches[1].english_phrase, "look after");
+    EXPECT_EQ(matches[1].position, 7);
+    EXPECT_EQ(matches[1].length, 10);
+    EXPECT_EQ(matches[2].english_phrase, "after");
+    EXPECT_EQ(matches[3].english_phrase, "cat");
+    EXPECT_EQ(text.substr(matches[3].position, matches[3].length), "cat");
+}
+
+TEST_F(PhraseMatcherTest, FindAll_MatchesWholeWordsOnly) {
+    phrase_matcher matcher(dict);
+    EXPECT_TRUE(matcher.find_all("category scat lookout afterwards").empty());
+}
+
+TEST_F(PhraseMatcherTest, FindAll_IgnoresCaseAndExtraSpaces) {
+    phrase_matcher matcher(dict);
+    std::string text = "GIVE   \n up";
+    auto matches = matcher.find_all(text);
+
+    ASSERT_EQ(matches.size(), 1);
+    EXPECT_EQ(matches[0].english_phrase, "give up");
+    EXPECT_EQ(matches[0].position, 0);
+    EXPECT_EQ(matches[0].length, text.size());
+    EXPECT_TRUE(dict.contains_word(matches[0].english_phrase));
+}
+
+TEST_F(PhraseMatcherTest, FindLongest_PrefersLongestLeftmostPhrase) {
+    phrase_matcher matcher(dict);
+    auto matches = matcher.find_longest("look after the cat, then look");
+
+    ASSERT_EQ(matches.size(), 3);
+    EXPECT_EQ(matches[0].english_phrase, "look after");
+    EXPECT_EQ(matches[1].english_phrase, "cat");
+    EXPECT_EQ(matches[2].english_phrase, "look");
+}
+
+TEST_F(PhraseMatcherTest, AddAndRemovePhrase_PatchAutomaton) {
+    phrase_matcher matcher(dict);
+    EXPECT_TRUE(matcher.add_phrase("the cat"));
+    EXPECT_FALSE(matcher.add_phrase("the cat"));
+    EXPECT_TRUE(matcher.remove_phrase("look after"));
+    EXPECT_FALSE(matcher.remove_phrase("look after"));
+    EXPECT_FALSE(matcher.remove_phrase("missing"));
+    EXPECT_EQ(matcher.get_phrase_number(), 5);
+
+    auto matches = matcher.find_longest("look after the cat");
+    ASSERT_EQ(matches.size(), 3);
+    EXPECT_EQ(matches[0].english_phrase, "look");
+    EXPECT_EQ(matches[1].english_phrase, "after");
+    EXPECT_EQ(matches[2].english_phrase, "the cat");
+}
+
+TEST_F(PhraseMatcherTest, Synchronize_RebuildsOnlyAfterChanges) {
+    phrase_matcher matcher(dict);
+    EXPECT_FALSE(matcher.synchronize(dict));
+
+    dict += std::make_pair("dog", "собака");
+    EXPECT_TRUE(matcher.synchronize(dict));
+    EXPECT_EQ(matcher.get_phrase_number(), 6);
+    EXPECT_EQ(matcher.find_all("a dog").size(), 1);
+}
+
+TEST_F(PhraseMatcherTest, EmptyMatcher_FindsNothing) {
+    phrase_matcher matcher;
+    EXPECT_TRUE(matcher.find_all("look after the cat").empty());
+    EXPECT_EQ(matcher.get_state_number(), 1);
+    EXPECT_THROW(matcher.add_phrase(""), std::invalid_argument);
+}
+
+TEST_F(PhraseMatcherTest, DictionaryInput_ReadsPhrases) {
+    dictionary phrases;
+    std::istringstream input("Look  After - Присматривать  за\nput off - откладывать\ncat кошка\n");
+    input >> phrases;
+
+    EXPECT_EQ(phrases.get_size(), 3);
+    EXPECT_EQ(phrases["look after"], "присматривать за");
+    EXPECT_EQ(phrases["put off"], "откладывать");
+    EXPECT_EQ(phrases["cat"], "кошка");
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "Sharded_dictionary.h"
+
+TEST(ShardedDictionaryTest, BasicOperations_MatchDictionary) {
+    sharded_dictionary dict(4);
+    dict += std::make_pair("apple", "яблоко");
+    dict += std::make_pair("book", "книга");
+    dict += std::make_pair("cat", "кошка");
+
+    EXPECT_EQ(dict.get_size(), 3);
+    EXPECT_EQ(dict["book"], "книга");
+    EXPECT_THROW(dict += std::make_pair("book", "тетрадь"), std::invalid_argument);
+    EXPECT_THROW(dict["dog"], std::out_of_range);
+
+    dict.set_translation("cat", "кот");
+    EXPECT_EQ(dict["cat"], "кот");
+    EXPECT_THROW(dict.set_translation("dog", "пес"), std::out_of_range);
+
+    dict -= "apple";
+    EXPECT_FALSE(dict.contains_word("apple"));
+    EXPECT_THROW(dict -= "apple", std::invalid_argument);
+    EXPECT_EQ(dict.get_size(), 2);
+    EXPECT_FALSE(dict.is_empty());
+}
+
+TEST(ShardedDictionaryTest, Printing_IsGloballyOrdered) {
+    sharded_dictionary sharded(8);
+    dictionary plain;
+    for (int i = 0; i < 1000; ++i) {
+        std::string english_word = "word" + std::to_string(i * 37 % 1000);
+        sharded += std::make_pair(english_word, std::string("слово"));
+        plain += std::make_pair(english_word, std::string("слово"));
+    }
+    std::ostringstream sharded_output, plain_output;
+    sharded_output << sharded;
+    plain_output << plain;
+
+    EXPECT_EQ(sharded_output.str(), plain_output.str());
+    EXPECT_EQ(sharded.get_fingerprint(), plain.get_fingerprint());
+    EXPECT_TRUE(sharded.to_dictionary() == plain);
+}
+
+TEST(ShardedDictionaryTest, StreamInputAndEquality) {
+    sharded_dictionary first(2), second(5);
+    std::istringstream first_input("apple яблоко\nlook after - присматривать за\n");
+    std::istringstream second_input("look after - присматривать за\napple яблоко\napple другое\n");
+    first_input >> first;
+    second_input >> second;
+
+    EXPECT_TRUE(first == second);
+    second.set_translation("apple", "другое");
+    EXPECT_TRUE(first != second);
+}
+
+TEST(ShardedDictionaryTest, ConcurrentWriters_DoNotLoseWords) {
+    sharded_dictionary dict(16);
+    const int thread_number = 4;
+    const int words_per_thread = 2000;
+    std::vector<std::thread> writers;
+    for (int t = 0; t < thread_number; ++t) {
+        writers.emplace_back([&dict, t]() {
+            for (int i = 0; i < words_per_thread; ++i) {
+                std::string english_word = "w" + std::to_string(t) + "x" + std::to_string(i);
+                dict += std::make_pair(english_word, std::string("слово"));
+                if (i % 2) dict -= english_word;
+                else dict.contains_word(english_word);
+            }
+        });
+    }
+    for (std::thread& writer : writers) writer.join();
+
+    EXPECT_EQ(dict.get_size(), thread_number * words_per_thread / 2);
+    EXPECT_TRUE(dict.contains_word("w3x0"));
+    EXPECT_FALSE(dict.contains_word("w3x1"));
+}
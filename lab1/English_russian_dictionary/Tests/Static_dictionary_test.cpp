@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "Static_dictionary.h"
+#include "Core_vocabulary.h"
+#include "Layered_dictionary.h"
+
+namespace {
+    constexpr auto small_vocabulary = make_static_dictionary({
+            {"dog", "собака"},
+            {"apple", "яблоко"},
+            {"cat", "кошка"},
+    });
+
+    static_assert(small_vocabulary.get_size() == 3);
+    static_assert(small_vocabulary.contains_word("apple"));
+    static_assert(!small_vocabulary.contains_word("book"));
+    static_assert(small_vocabulary["cat"] == "кошка");
+    static_assert(core_vocabulary.contains_word("look after"));
+}
+
+TEST(StaticDictionaryTest, Lookup_MatchesDictionaryApi) {
+    EXPECT_TRUE(small_vocabulary.contains_word("dog"));
+    EXPECT_FALSE(small_vocabulary.contains_word("do"));
+    EXPECT_FALSE(small_vocabulary.contains_word("zebra"));
+    EXPECT_EQ(small_vocabulary["apple"], "яблоко");
+    EXPECT_THROW(small_vocabulary["book"], std::out_of_range);
+    EXPECT_FALSE(small_vocabulary.is_empty());
+}
+
+TEST(StaticDictionaryTest, ForEachWord_VisitsWordsInOrder) {
+    std::vector<std::string> words;
+    small_vocabulary.for_each_word([&words](std::string_view english_word, std::string_view) {
+        words.emplace_back(english_word);
+    });
+    EXPECT_EQ(words, (std::vector<std::string>{"apple", "cat", "dog"}));
+
+    std::string previous;
+    core_vocabulary.for_each_word([&previous](std::string_view english_word, std::string_view) {
+        EXPECT_LT(previous, std::string(english_word));
+        previous = english_word;
+    });
+}
+
+TEST(StaticDictionaryTest, DuplicateWord_IsRejected) {
+    EXPECT_THROW(make_static_dictionary({{"cat", "кошка"}, {"cat", "кот"}}), std::invalid_argument);
+}
+
+TEST(LayeredDictionaryTest, UserWords_LayerOnTopOfCore) {
+    layered_dictionary dict(small_vocabulary.get_vocabulary());
+    EXPECT_EQ(dict.get_size(), 3);
+
+    dict += std::make_pair("book", "книга");
+    EXPECT_THROW(dict += std::make_pair("cat", "кот"), std::invalid_argument);
+    dict.set_translation("cat", "кот");
+
+    EXPECT_EQ(dict["cat"], "кот");
+    EXPECT_EQ(dict["book"], "книга");
+    EXPECT_EQ(dict["dog"], "собака");
+    EXPECT_EQ(dict.get_size(), 4);
+    EXPECT_EQ(dict.get_user_words().get_size(), 2);
+    EXPECT_EQ(small_vocabulary["cat"], "кошка");
+}
+
+TEST(LayeredDictionaryTest, RemovingCoreWord_HidesIt) {
+    layered_dictionary dict(small_vocabulary.get_vocabulary());
+    dict.set_translation("cat", "кот");
+    dict -= "cat";
+    dict -= "dog";
+
+    EXPECT_FALSE(dict.contains_word("cat"));
+    EXPECT_THROW(dict["dog"], std::out_of_range);
+    EXPECT_THROW(dict -= "dog", std::invalid_argument);
+    EXPECT_THROW(dict.set_translation("dog", "пес"), std::out_of_range);
+    EXPECT_EQ(dict.get_size(), 1);
+
+    dict += std::make_pair("dog", "пес");
+    EXPECT_EQ(dict["dog"], "пес");
+    EXPECT_EQ(dict.get_size(), 2);
+}
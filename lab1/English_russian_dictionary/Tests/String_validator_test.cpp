@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <string>
 #include <stdexcept>
+#include <sstream>
+#include <vector>
 #include "String_validator.h"
 
 using namespace std;
@@ -364,3 +366,61 @@ TEST_F(StringValidatorTest, ToLower_InvalidUTF8Sequences) {
     EXPECT_FALSE(result.empty());
 }
 
+
+TEST_F(StringValidatorTest, NormalizePhrase_CollapsesSpacesAndLowersCase) {
+    EXPECT_EQ(string_validator::normalize_phrase("  Look \t After  "), "look after");
+    EXPECT_EQ(string_validator::normalize_phrase("ПРИСМАТРИВАТЬ   ЗА"), "присматривать за");
+    EXPECT_EQ(string_validator::normalize_phrase("   "), "");
+}
+
+TEST_F(StringValidatorTest, ValidPhrase_ChecksEveryWord) {
+    EXPECT_TRUE(string_validator::valid_english_phrase("look after"));
+    EXPECT_TRUE(string_validator::valid_english_phrase("state-of-the-art"));
+    EXPECT_FALSE(string_validator::valid_english_phrase("look  after"));
+    EXPECT_FALSE(string_validator::valid_english_phrase("look after1"));
+    EXPECT_FALSE(string_validator::valid_english_phrase(""));
+    EXPECT_FALSE(string_validator::valid_english_phrase(string(101, 'a')));
+
+    EXPECT_TRUE(string_validator::valid_russian_phrase("присматривать за"));
+    EXPECT_FALSE(string_validator::valid_russian_phrase("присматривать за!"));
+}
+
+TEST_F(StringValidatorTest, WordPairInput_PhraseWithSeparator) {
+    auto result = string_validator::word_pair_input("  Give   Up - Сдаваться  ");
+    EXPECT_EQ(result.first, "give up");
+    EXPECT_EQ(result.second, "сдаваться");
+
+    result = string_validator::word_pair_input("look after - присматривать за");
+    EXPECT_EQ(result.second, "присматривать за");
+
+    result = string_validator::word_pair_input("apple - яблоко");
+    EXPECT_EQ(result.first, "apple");
+    EXPECT_EQ(result.second, "яблоко");
+
+    EXPECT_THROW(string_validator::word_pair_input("look after2 - смотреть"), invalid_argument);
+}
+
+TEST_F(StringValidatorTest, WordPairInput_SingleWordBeforeSeparatorKeepsFirstTranslation) {
+    auto result = string_validator::word_pair_input("apple - яблоко (плод)");
+    EXPECT_EQ(result.first, "apple");
+    EXPECT_EQ(result.second, "яблоко");
+
+    result = string_validator::word_pair_input("Book - книга");
+    EXPECT_EQ(result.first, "book");
+    EXPECT_EQ(result.second, "книга");
+}
+
+TEST_F(StringValidatorTest, ReadWordPairs_SkipsBadLinesAndStopsOnRequest) {
+    istringstream input("apple яблоко\n\n123 число\nbook книга\ncat кот\n");
+    vector<pair<string, string>> pairs;
+    size_t line_number = 0;
+    size_t skipped = string_validator::read_word_pairs(input, [&pairs](const pair<string, string>& new_pair) {
+        pairs.push_back(new_pair);
+    }, [&line_number](size_t) { return ++line_number < 4; });
+
+    EXPECT_EQ(skipped, 1u);
+    EXPECT_EQ(line_number, 4u);
+    ASSERT_EQ(pairs.size(), 2u);
+    EXPECT_EQ(pairs[0].first, "apple");
+    EXPECT_EQ(pairs[1].second, "книга");
+}
@@ -5,19 +5,26 @@
  * Этот файл содержит точку входа в программу и реализацию пользовательского интерфейса
  * для работы с англо-русским словарем. Программа предоставляет возможности добавления,
  * удаления, поиска и изменения слов в словаре, а также загрузки данных из файла.
+ * С аргументами --batch файл программа выполняет команды из файла без меню.
  *
  * @author Ященко Александра
  * @see Dictionary.h
  * @see String_validator.h
+ * @see Async_dictionary.h
  */
 
 #include <iostream>
 #include <string>
+#include <fstream>
+#ifdef _WIN32
 #include <windows.h>
+#endif
 #include <stdexcept>
 #include <limits>
 #include "Dictionary/Dictionary.h"
 #include "Dictionary/String_validator.h"
+#include "Dictionary/Batch_executor.h"
+#include "Dictionary/Async_dictionary.h"
 
 /**
  * @brief Выводит количество слов в словаре
@@ -32,7 +39,7 @@ void get_word_number(dictionary& dictionary_) {
  * @details
  * Функция запрашивает ввод слова, удаляет лишние пробелы и проверяет,
  * что слово не пустое. В случае ошибки выводит сообщение и запрашивает повторный ввод.
- * @return Введенное слово в нижнем регистре
+ * @return Введенное слово или фраза в нижнем регистре, слова разделены одним пробелом
  */
 std::string input_word() {
     std::string word_to_input;
@@ -44,7 +51,7 @@ std::string input_word() {
         if (!word_to_input.empty()) break;
         std::cout << "Ошибка: слово не может быть пустым.\n Попробуйте снова: ";
     }
-    return string_validator::to_lower(word_to_input);
+    return string_validator::normalize_phrase(word_to_input);
 }
 
 /**
@@ -55,7 +62,7 @@ std::string input_word() {
 std::string input_english_word(std::string& english_word) {
     std::cout << "Введите английское слово: ";
     english_word = input_word();
-    if (!string_validator::valid_english_word(english_word)) {
+    if (!string_validator::valid_english_phrase(english_word)) {
         std::cout << "Слово введено некорректно.\n";
         return "";
     }
@@ -69,7 +76,7 @@ std::string input_english_word(std::string& english_word) {
  */
 std::string input_russian_word(std::string& russian_word) {
     russian_word = input_word();
-    if (!string_validator::valid_russian_word(russian_word)) {
+    if (!string_validator::valid_russian_phrase(russian_word)) {
         std::cout << "Слово введено некорректно.\n";
         return "";
     }
@@ -86,13 +93,13 @@ std::string input_russian_word(std::string& russian_word) {
 void add_word(dictionary& dictionary_) {
     std::cout << "Введите английское слово: ";
     std::string english_word = input_word();
-    if (!string_validator::valid_english_word(english_word)) {
+    if (!string_validator::valid_english_phrase(english_word)) {
         std::cout << "Слово введено некорректно.\n";
         return;
     }
     std::cout << "Введите перевод: ";
     std::string russian_word = input_word();
-    if (!string_validator::valid_russian_word(russian_word)) {
+    if (!string_validator::valid_russian_phrase(russian_word)) {
         std::cout << "Слово введено некорректно.\n";
         return;
     }
@@ -138,11 +145,12 @@ void find_translation(dictionary& dictionary_) {
             return;
         }
         try {
-            if (dictionary_[english_word].empty()){
+            const dictionary& lookup_dictionary = dictionary_;
+            if (lookup_dictionary[english_word].empty()){
                 std::cout << "Перевод не найден.\n";
                 return;
             }
-            std::cout << "Английское слово: " << english_word << "\n" << "Перевод: " << dictionary_[english_word]
+            std::cout << "Английское слово: " << english_word << "\n" << "Перевод: " << lookup_dictionary[english_word]
                       << "\n";
         } catch (const std::out_of_range &exception) {
             std::cout << "Поймано исключение: " << exception.what() << std::endl;
@@ -166,8 +174,9 @@ void change_translation(dictionary& dictionary_) {
         std::cout << "Введите новый перевод: ";
         if(input_russian_word(new_russian_word).empty()) return;
         try {
-            dictionary_[english_word] = new_russian_word;
-            std::cout << "Английское слово: " << english_word << "\n" << "Новый перевод: " << dictionary_[english_word]
+            dictionary_.set_translation(english_word, new_russian_word);
+            const dictionary& lookup_dictionary = dictionary_;
+            std::cout << "Английское слово: " << english_word << "\n" << "Новый перевод: " << lookup_dictionary[english_word]
                       << "\n";
         } catch (const std::out_of_range &exception) {
             std::cout << "Поймано исключение: " << exception.what() << std::endl;
@@ -187,15 +196,68 @@ void print_dictionary_helper(dictionary& dictionary_) {
 }
 
 /**
- * @brief Загрузка словаря из файла
+ * @brief Запуск загрузки словаря из файла
  * @details
- * Функция загружает словарь из файла "dictionary.txt" в текущей директории.
- * @param dictionary_ Ссылка на объект словаря
+ * Функция начинает фоновую загрузку файла "dictionary.txt" в текущей директории.
+ * Пока файл читается, меню остается доступным, а поиск выполняется по прежнему словарю.
+ * @param loader Объект фоновой загрузки
+ * @param load_pending Признак незабранной загрузки
+ * @see collect_loaded_words
  */
-void upload_from_file(dictionary& dictionary_) {
+void upload_from_file(async_dictionary& loader, bool& load_pending) {
     std::string file_name = "dictionary.txt";
-    dictionary_.read_from_file(file_name);
-    if (!dictionary_.is_empty()) std::cout << "Словарь загружен из файла.\n";
+    try {
+        loader.load_async(file_name);
+        load_pending = true;
+        std::cout << "Загрузка словаря из файла начата.\n";
+    } catch (const std::runtime_error& exception) {
+        std::cout << exception.what() << "\n";
+    }
+}
+
+/**
+ * @brief Добавление в словарь слов, загруженных в фоне
+ * @details
+ * Слова, которые уже есть в словаре, не заменяются, как при read_from_file.
+ * Если файл не удалось открыть, словарь не меняется.
+ * @param loader Объект фоновой загрузки
+ * @param load_pending Признак незабранной загрузки
+ * @param dictionary_ Ссылка на объект словаря
+ * @param wait Ждать окончания загрузки, если она еще идет
+ */
+void collect_loaded_words(async_dictionary& loader, bool& load_pending, dictionary& dictionary_, bool wait) {
+    if (!load_pending || (!wait && !loader.is_ready())) return;
+    load_pending = false;
+    try {
+        std::shared_ptr<const dictionary> loaded = loader.wait_ready();
+        dictionary_.merge(*loaded);
+        if (!dictionary_.is_empty()) std::cout << "Словарь загружен из файла.\n";
+    } catch (const std::runtime_error& exception) {
+
+    }
+}
+
+/**
+ * @brief Выполнение команд из файла без меню
+ * @details
+ * Результаты команд выводятся в стандартный поток вывода, итог с количеством
+ * команд, ошибок и скоростью выполнения - в поток ошибок.
+ * @param file_name Имя файла команд
+ * @return Код завершения: 0 если все команды выполнены, 1 если были ошибки
+ * @see batch_executor
+ */
+int run_batch(const std::string& file_name) {
+    std::ifstream command_file(file_name);
+    if (!command_file.is_open()) {
+        std::cerr << "Не удалось открыть файл " << file_name << "\n";
+        return 1;
+    }
+    std::ios::sync_with_stdio(false);
+    dictionary my_dictionary;
+    batch_executor executor(my_dictionary, std::cout);
+    batch_report report = executor.execute(command_file);
+    std::cerr << report;
+    return report.error_number ? 1 : 0;
 }
 
 /**
@@ -204,17 +266,30 @@ void upload_from_file(dictionary& dictionary_) {
  * @details
  * Функция инициализирует консоль для поддержки UTF-8, создает объект словаря
  * и предоставляет пользовательское меню для взаимодействия со словарем.
+ * Если передан аргумент --batch с именем файла, выполняет команды из файла.
+ * @param argc Количество аргументов командной строки
+ * @param argv Аргументы командной строки
  * @return Код завершения программы (0 - успешное завершение)
  * @see dictionary
+ * @see run_batch
  */
-int main() {
+int main(int argc, char* argv[]) {
 
+#ifdef _WIN32
     SetConsoleOutputCP(CP_UTF8);
     SetConsoleCP(CP_UTF8);
+#endif
+    if (argc == 3 && std::string(argv[1]) == "--batch") return run_batch(argv[2]);
     dictionary my_dictionary;
+    async_dictionary loader;
+    bool load_pending = false;
 
     while(true){
         int menu_option;
+        collect_loaded_words(loader, load_pending, my_dictionary, false);
+        if (load_pending) {
+            std::cout << "Идет загрузка словаря: " << static_cast<int>(loader.get_progress() * 100) << "%\n";
+        }
         std::cout <<  "Меню выбора операции:\n"
                   << "  1.  Добавить слово\n"
                   << "  2.  Удалить слово\n"
@@ -232,15 +307,18 @@ int main() {
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
         switch(menu_option){
             case 1:
+                collect_loaded_words(loader, load_pending, my_dictionary, true);
                 add_word(my_dictionary);
                 break;
             case 2:
+                collect_loaded_words(loader, load_pending, my_dictionary, true);
                 delete_word(my_dictionary);
                 break;
             case 3:
                 find_translation(my_dictionary);
                 break;
             case 4:
+                collect_loaded_words(loader, load_pending, my_dictionary, true);
                 change_translation(my_dictionary);
                 break;
             case 5:
@@ -250,7 +328,7 @@ int main() {
                 print_dictionary_helper(my_dictionary);
                 break;
             case 7:
-                upload_from_file(my_dictionary);
+                upload_from_file(loader, load_pending);
                 break;
             default:
                 return 0;